@@ -8,6 +8,7 @@
 #include "Global/Player.hpp"
 #include "Global/Zone.hpp"
 #include "Global/DebugMode.hpp"
+#include "Helpers/BadnikHelpers.hpp"
 
 using namespace RSDK;
 
@@ -15,6 +16,20 @@ namespace GameLogic
 {
 RSDK_REGISTER_OBJECT(Grounder);
 
+// the bricks a hidden grounder bursts out of
+static const BadnikHelpers::BurstPiece brickBurst[] = {
+    { 0, 0, -0x10000, -0x40000 },
+    { 0, 0, 0x40000, -0x30000 },
+    { 0, 0, 0x20000, 0 },
+    { 0, 0, -0x30000, -0x10000 },
+    { 0, 0, -0x30000, -0x30000 },
+    { 0, -0x140000, 0x10000, -0x20000 },
+    { 0x100000, -0x40000, 0x10000, -0x10000 },
+    { 0, 0xC0000, -0x10000, -0x20000 },
+    { -0x100000, -0x40000, -0x10000, -0x10000 },
+};
+static const uint8 brickBurstFrames[] = { 1, 3, 1, 2, 1, 0, 0, 0, 0 };
+
 void Grounder::Update()
 {
     if (!this->isBrick) {
@@ -160,56 +175,9 @@ void Grounder::State_Hidden()
 
 	for (auto currentPlayer : GameObject::GetEntities<Player>(FOR_ACTIVE_ENTITIES)) {
 		if (currentPlayer->CheckCollisionTouch(this, &sVars->hiddenHitbox)) {
-            Grounder *brick = GameObject::Create<Grounder>(INT_TO_VOID(true), this->position.x, this->position.y);
-			brick->velocity.x = -0x10000;
-			brick->velocity.y = -0x40000;
-			brick->brickFrame = 1;
-			
-			Grounder *brick2 = GameObject::Create<Grounder>(INT_TO_VOID(true), this->position.x, this->position.y);
-			brick2->velocity.x = 0x40000;
-			brick2->velocity.y = -0x30000;
-			brick2->brickFrame = 3;
-			
-			Grounder *brick3 = GameObject::Create<Grounder>(INT_TO_VOID(true), this->position.x, this->position.y);
-			brick3->velocity.x = 0x20000;
-			brick3->velocity.y = 0;
-			brick3->brickFrame = 1;
-
-			Grounder *brick4 = GameObject::Create<Grounder>(INT_TO_VOID(true), this->position.x, this->position.y);
-			brick4->velocity.x = -0x30000;
-			brick4->velocity.y = -0x10000;
-			brick4->brickFrame = 2;
-
-			Grounder *brick5 = GameObject::Create<Grounder>(INT_TO_VOID(true), this->position.x, this->position.y);
-			brick5->velocity.x = -0x30000;
-			brick5->velocity.y = -0x30000;
-			brick5->brickFrame = 1;
-
-			Grounder *brick6 = GameObject::Create<Grounder>(INT_TO_VOID(true), this->position.x, this->position.y);
-			brick6->position.y -= 0x140000;
-			brick6->velocity.x = 0x10000;
-			brick6->velocity.y = -0x20000;
-			brick6->brickFrame = 0;
-			
-			Grounder *brick7 = GameObject::Create<Grounder>(INT_TO_VOID(true), this->position.x, this->position.y);
-			brick7->position.x += 0x100000;
-			brick7->position.y -= 0x40000;
-			brick7->velocity.x = 0x10000;
-			brick7->velocity.y = -0x10000;
-			brick7->brickFrame = 0;
-			
-			Grounder *brick8 = GameObject::Create<Grounder>(INT_TO_VOID(true), this->position.x, this->position.y);
-			brick8->position.y += 0xC0000;
-			brick8->velocity.x = -0x10000;
-			brick8->velocity.y = -0x20000;
-			brick8->brickFrame = 0;
-			
-			Grounder *brick9 = GameObject::Create<Grounder>(INT_TO_VOID(true), this->position.x, this->position.y);
-			brick9->position.x -= 0x100000;
-			brick9->position.y -= 0x40000;
-			brick9->velocity.x = -0x10000;
-			brick9->velocity.y = -0x10000;
-			brick9->brickFrame = 0;
+            Grounder *bricks[9];
+            BadnikHelpers::SpawnBurst<Grounder>(INT_TO_VOID(true), this->position.x, this->position.y, brickBurst, 9, bricks);
+            for (int32 b = 0; b < 9; ++b) bricks[b]->brickFrame = brickBurstFrames[b];
 
 			this->TileGrip(Zone::sVars->collisionLayers, CMODE_FLOOR, this->collisionPlane, 0, 20 << 16, 8);
 			this->animator.SetAnimation(sVars->aniFrames, Appear, false, 0);
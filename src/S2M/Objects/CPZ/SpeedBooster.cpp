@@ -42,7 +42,7 @@ void SpeedBooster::Create(void *data)
 
     this->active = ACTIVE_BOUNDS;
     if (!this->speed)
-        this->speed = Stage::CheckSceneFolder("CPZ") ? 10 : 16;
+        this->speed = Zone::SceneFolder() == SceneIdentity::FolderCPZ ? 10 : 16;
     this->groundVel = this->speed << 16;
 
     this->animator.SetAnimation(sVars->aniFrames, 0, true, 0);
@@ -131,7 +131,7 @@ void SpeedBooster::EditorDraw()
 
     this->active = ACTIVE_BOUNDS;
     if (!this->speed)
-        this->speed = Stage::CheckSceneFolder("CPZ") ? 10 : 16;
+        this->speed = Zone::SceneFolder() == SceneIdentity::FolderCPZ ? 10 : 16;
     this->groundVel = this->speed << 16;
 
     this->animator.SetAnimation(sVars->aniFrames, 0, true, 0);
@@ -56,28 +56,8 @@ void Staircase::StageLoad()
     // What a name tbh
     // apparently this sound doesnt actually exist in the game?? oh well
     sVars->sfxBlockStop.Get("CPZ/CPZ2HitBlocksStop.wav");
-    Soundboard::LoadSfx(Staircase::SfxCheck_HitBlocks, nullptr);
-}
-
-Soundboard::SoundInfo Staircase::SfxCheck_HitBlocks()
-{
-    SoundFX hitBlocksSFX;
-    hitBlocksSFX.Get("CPZ/CPZ2HitBlocks.wav");
-    Soundboard::SoundInfo info = {};
-    info.sfx                   = hitBlocksSFX;
-    info.loopPoint             = true;
-
-    for (auto entity : GameObject::GetEntities<Staircase>(FOR_ACTIVE_ENTITIES))
-    {
-        if (entity->stateDraw.Matches(&Staircase::Draw_Shake))
-            //return true;
-            info.playFlags = true;
-            return info;
-    }
-
-    //return false;
-    info.playFlags = false;
-    return info;
+    // held by every staircase that's shaking
+    sVars->sfxHitBlocks = Soundboard::LoadSfxName("CPZ/CPZ2HitBlocks.wav", true, nullptr, nullptr);
 }
 
 void Staircase::State_Idle()
@@ -93,6 +73,8 @@ void Staircase::State_Idle()
                 this->active    = ACTIVE_NORMAL;
                 this->timer     = 59;
                 this->state.Set(&Staircase::State_Wait);
+                if (!this->stateDraw.Matches(&Staircase::Draw_Shake))
+                    Soundboard::AcquireLoop(sVars->sfxHitBlocks);
                 this->stateDraw.Set(&Staircase::Draw_Shake);
                 if (player->onGround)
                     player->deathType = Player::DeathDie_Sfx;
@@ -124,12 +106,17 @@ void Staircase::State_Wait()
         this->timer = 128;
         if (!sVars->sfxBlockStop.IsPlaying())
             sVars->sfxBlockStop.Play(false, 255);
+        if (this->stateDraw.Matches(&Staircase::Draw_Shake))
+            Soundboard::ReleaseLoop(sVars->sfxHitBlocks);
         this->state    .Set(&Staircase::State_MoveBlocks);
         this->stateDraw.Set(&Staircase::Draw_Blocks);
     }
 
-    if (!this->CheckOnScreen(&this->updateRange))
+    if (!this->CheckOnScreen(&this->updateRange)) {
+        if (this->stateDraw.Matches(&Staircase::Draw_Shake))
+            Soundboard::ReleaseLoop(sVars->sfxHitBlocks);
         Staircase::Create(nullptr);
+    }
 }
 
 void Staircase::State_MoveBlocks()
@@ -30,6 +30,7 @@ struct Staircase : RSDK::GameObject::Entity {
         RSDK::Hitbox blockHitbox;
         RSDK::SpriteAnimation aniFrames;
         RSDK::SoundFX sfxBlockStop;
+        uint8 sfxHitBlocks;
     };
 
     // ==============================
@@ -66,8 +67,6 @@ struct Staircase : RSDK::GameObject::Entity {
     // FUNCTIONS
     // ==============================
 
-    static Soundboard::SoundInfo SfxCheck_HitBlocks();
-
     void State_Idle();
     void State_Wait();
     void State_MoveBlocks();
@@ -11,6 +11,7 @@
 #include "Global/Shield.hpp"
 #include "Global/ScoreBonus.hpp"
 #include "ForceSpin.hpp"
+#include "Helpers/SolidIndex.hpp"
 
 using namespace RSDK;
 
@@ -202,6 +203,9 @@ void BreakableWall::Create(void *data)
             this->hitbox.bottom = 8 * this->size.y;
         }
     }
+
+    if (!sceneInfo->inEditor)
+        SolidIndex::Register(this, SolidIndex::SolidBreakableWall);
 }
 
 void BreakableWall::StageLoad()
@@ -751,12 +755,6 @@ void BreakableWall::Break(uint8 direction)
                 }
             }
 
-            this->targetLayer.SetTile(tileX, tileY, -1);
-            if (this->drawGroup < Zone::sVars->objectDrawGroup[0]) {
-                if (sVars->farPlaneLayer.Loaded())
-                    sVars->farPlaneLayer.SetTile(tileX, tileY, -1);
-            }
-
             curX += 0x10 << 16;
             angleX += 0x200000;
         }
@@ -764,6 +762,11 @@ void BreakableWall::Break(uint8 direction)
         curY += 0x10 << 16;
     }
 
+    // every tile above was read before any got cleared, so the whole wall can go in one go
+    Zone::FillTiles(this->targetLayer.id, endX >> 20, endY >> 20, this->size.x, this->size.y, -1);
+    if (this->drawGroup < Zone::sVars->objectDrawGroup[0] && sVars->farPlaneLayer.Loaded())
+        Zone::FillTiles(sVars->farPlaneLayer.id, endX >> 20, endY >> 20, this->size.x, this->size.y, -1);
+
     if (this->useLayerDrawGroup)
         this->position = storePos;
 }
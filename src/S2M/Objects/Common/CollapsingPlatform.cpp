@@ -95,30 +95,17 @@ void CollapsingPlatform::Update()
             int32 xOff = (this->originPos.x >> 20) - (this->size.x >> 21);
             int32 yOff = (this->originPos.y >> 20) - (this->size.y >> 21);
 
-            if ((this->size.y & 0xFFF00000) && !(this->size.y & 0xFFF00000 & 0x80000000)) {
-                int32 sx = this->size.x >> 20;
-                int32 sy = this->size.y >> 20;
-                for (int32 y = 0; y < sy; ++y) {
-                    for (int32 x = 0; x < sx; ++x) {
-                        this->targetLayer.SetTile(x + xOff, y + yOff, this->storedTiles[x + y * (this->size.x >> 20)]);
-                    }
-                }
-            }
+            if ((this->size.y & 0xFFF00000) && !(this->size.y & 0xFFF00000 & 0x80000000))
+                Zone::WriteTiles(this->targetLayer.id, xOff, yOff, this->size.x >> 20, this->size.y >> 20, this->storedTiles);
 
             if (this->useLayerDrawGroup) {
                 int32 xOff = (this->originPos.x >> 20) - (this->size.x >> 21);
                 int32 yOff = (this->originPos.y >> 20) - (this->size.y >> 21);
 
                 if ((this->size.y & 0xFFF00000) && !(this->size.y & 0xFFF00000 & 0x80000000)) {
-                    int32 sx = this->size.x >> 20;
-                    int32 sy = this->size.y >> 20;
-                    for (int32 y = 0; y < sy; ++y) {
-                        for (int32 x = 0; x < sx; ++x) {
-                            int32 bufferX = ScreenWrap::sVars->activeVWrap->buffer.x >> 16;
-                            this->targetLayer.SetTile(x + xOff + ((bufferX + ((bufferX >> 27) & 0xF)) >> 4), y + yOff,
-                                                      this->storedTiles[x + y * (this->size.x >> 20)]);
-                        }
-                    }
+                    int32 bufferX = ScreenWrap::sVars->activeVWrap->buffer.x >> 16;
+                    Zone::WriteTiles(this->targetLayer.id, xOff + ((bufferX + ((bufferX >> 27) & 0xF)) >> 4), yOff, this->size.x >> 20,
+                                     this->size.y >> 20, this->storedTiles);
                 }
             }
 
@@ -1323,6 +1323,9 @@ void Platform::Collision_Solid()
     Hitbox *platformHitbox = this->animator.GetHitbox(0);
     int32 stoodPlayers     = this->stoodPlayers;
 
+    CollisionReach reach;
+    SetupReach(&reach, solidHitbox, platformHitbox);
+
     if (!ScreenWrap::CheckCompetitionWrap() || !ScreenWrap::sVars->handlingWrap) {
         this->stoodPlayers = 0;
         this->pushPlayersL = 0;
@@ -1335,6 +1338,9 @@ void Platform::Collision_Solid()
         if (!ScreenWrap::Unknown1(player, this))
             continue;
 
+        if (!CheckReach(&reach, player))
+            continue;
+
         player->CheckCollisionPlatform(this, platformHitbox);
 
         switch (player->CheckCollisionBox(this, solidHitbox)) {
@@ -1403,7 +1409,13 @@ void Platform::Collision_Hurt()
     if (this->timer)
         this->timer--;
 
+    CollisionReach reach;
+    SetupReach(&reach, &this->hitbox, nullptr);
+
     for (auto player : GameObject::GetEntities<Player>(FOR_ACTIVE_ENTITIES)) {
+        if (!CheckReach(&reach, player))
+            continue;
+
         if (player->CheckCollisionBox(this, &this->hitbox)) {
                 player->Hurt(this);
         }
@@ -1415,12 +1427,18 @@ void Platform::Collision_Solid_Hurt_Bottom()
     Hitbox *platformHitbox = this->animator.GetHitbox(0);
     int32 stoodPlayers     = this->stoodPlayers;
 
+    CollisionReach reach;
+    SetupReach(&reach, solidHitbox, platformHitbox);
+
     this->stoodPlayers = 0;
     this->pushPlayersL = 0;
     this->pushPlayersR = 0;
 
     for (auto player : GameObject::GetEntities<Player>(FOR_ACTIVE_ENTITIES)) {
         int32 playerID = player->Slot();
+        if (!CheckReach(&reach, player))
+            continue;
+
         player->CheckCollisionPlatform(this, platformHitbox);
 
         switch (player->CheckCollisionBox(this, solidHitbox)) {
@@ -1490,11 +1508,16 @@ void Platform::Collision_Solid_Hurt_Sides()
     Hitbox *solidHitbox = this->animator.GetHitbox(1);
     int32 stoodPlayers  = this->stoodPlayers;
 
+    CollisionReach reach;
+    SetupReach(&reach, solidHitbox, nullptr);
+
     this->stoodPlayers = 0;
     this->pushPlayersL = 0;
     this->pushPlayersR = 0;
     for (auto player : GameObject::GetEntities<Player>(FOR_ACTIVE_ENTITIES)) {
         uint16 playerID = player->Slot();
+        if (!CheckReach(&reach, player))
+            continue;
 
         switch (player->CheckCollisionBox(this, solidHitbox)) {
             case C_TOP:
@@ -1567,14 +1590,21 @@ void Platform::Collision_Tiles()
     this->pushPlayersL = 0;
     this->pushPlayersR = 0;
 
+    Hitbox touchHitbox;
+    touchHitbox.left   = this->hitbox.left - 16;
+    touchHitbox.top    = this->hitbox.top - 16;
+    touchHitbox.right  = this->hitbox.right + 16;
+    touchHitbox.bottom = this->hitbox.bottom + 16;
+
+    CollisionReach reach;
+    SetupReach(&reach, &touchHitbox, nullptr);
+
     for (auto player : GameObject::GetEntities<Player>(FOR_ACTIVE_ENTITIES)) {
         int32 playerID = player->Slot();
+        if (!CheckReach(&reach, player))
+            continue;
 
-        Hitbox hitbox;
-        hitbox.left   = this->hitbox.left - 16;
-        hitbox.top    = this->hitbox.top - 16;
-        hitbox.right  = this->hitbox.right + 16;
-        hitbox.bottom = this->hitbox.bottom + 16;
+        Hitbox hitbox = touchHitbox;
 
         if (player->CheckCollisionTouch(this, &hitbox)) {
             player->collisionLayers |= Zone::sVars->moveLayerMask;
@@ -1647,10 +1677,17 @@ void Platform::Collision_Sticky()
     Hitbox *solidHitbox    = this->animator.GetHitbox(1);
     Hitbox *platformHitbox = this->animator.GetHitbox(0);
 
+    CollisionReach reach;
+    SetupReach(&reach, solidHitbox, platformHitbox);
+
     this->pushPlayersL = 0;
     this->pushPlayersR = 0;
     for (auto player : GameObject::GetEntities<Player>(FOR_ACTIVE_ENTITIES)) {
         uint16 playerID = player->Slot();
+        // stuck players get carried along by HandleStood_Sticky whether they're touching it or not
+        if (!((1 << playerID) & this->stoodPlayers) && !CheckReach(&reach, player))
+            continue;
+
         player->CheckCollisionPlatform(this, platformHitbox);
 
         int32 side = player->CheckCollisionBox(this, solidHitbox);
@@ -1663,11 +1700,16 @@ void Platform::Collision_Solid_Hurt_Top()
     Hitbox *solidHitbox = this->animator.GetHitbox(1);
     int32 stoodPlayers  = this->stoodPlayers;
 
+    CollisionReach reach;
+    SetupReach(&reach, solidHitbox, nullptr);
+
     this->stoodPlayers = 0;
     this->pushPlayersL = 0;
     this->pushPlayersR = 0;
     for (auto player : GameObject::GetEntities<Player>(FOR_ACTIVE_ENTITIES)) {
         uint16 playerID = player->Slot();
+        if (!CheckReach(&reach, player))
+            continue;
 
         switch (player->CheckCollisionBox(this, solidHitbox)) {
             case C_TOP:
@@ -1738,9 +1780,12 @@ void Platform::Collision_Platform()
     Hitbox *platformHitbox = this->animator.GetHitbox(0);
     int32 stoodPlayers     = this->stoodPlayers;
 
+    CollisionReach reach;
+    SetupReach(&reach, platformHitbox, nullptr);
+
     this->stoodPlayers = 0;
     for (auto player : GameObject::GetEntities<Player>(FOR_ACTIVE_ENTITIES)) {
-        if (player->shield >= Shield::Unknown)
+        if (player->shield >= Shield::Unknown || !CheckReach(&reach, player))
             continue;
 
         uint16 playerID = player->Slot();
@@ -1772,11 +1817,17 @@ void Platform::Collision_Solid_Barrel()
     Hitbox *platformHitbox = this->animator.GetHitbox(0);
     int32 stoodPlayers     = this->stoodPlayers;
 
+    CollisionReach reach;
+    SetupReach(&reach, solidHitbox, platformHitbox);
+
     this->stoodPlayers = 0;
     this->pushPlayersL = 0;
     this->pushPlayersR = 0;
     for (auto player : GameObject::GetEntities<Player>(FOR_ACTIVE_ENTITIES)) {
         uint16 playerID = player->Slot();
+        if (!CheckReach(&reach, player))
+            continue;
+
         player->CheckCollisionPlatform(this, platformHitbox);
 
         switch (player->CheckCollisionBox(this, solidHitbox)) {
@@ -1820,11 +1871,18 @@ void Platform::Collision_Solid_Hold()
     Hitbox *platformHitbox = this->animator.GetHitbox(0);
     int32 stoodPlayers     = this->stoodPlayers;
 
+    CollisionReach reach;
+    SetupReach(&reach, solidHitbox, platformHitbox);
+
     this->stoodPlayers = 0;
     this->pushPlayersL = 0;
     this->pushPlayersR = 0;
     for (auto player : GameObject::GetEntities<Player>(FOR_ACTIVE_ENTITIES)) {
         uint16 playerID = player->Slot();
+        // players that were held still need to see C_NONE to be let go
+        if (!((1 << playerID) & stoodPlayers) && !CheckReach(&reach, player))
+            continue;
+
         player->CheckCollisionPlatform(this, platformHitbox);
 
         switch (player->CheckCollisionBox(this, solidHitbox)) {
@@ -1881,11 +1939,17 @@ void Platform::Collision_Solid_NoCrush()
     Hitbox *platformHitbox = this->animator.GetHitbox(0);
     int32 stoodPlayers     = this->stoodPlayers;
 
+    CollisionReach reach;
+    SetupReach(&reach, solidHitbox, platformHitbox);
+
     this->stoodPlayers = 0;
     this->pushPlayersL = 0;
     this->pushPlayersR = 0;
     for (auto player : GameObject::GetEntities<Player>(FOR_ACTIVE_ENTITIES)) {
         uint16 playerID = player->Slot();
+        if (!CheckReach(&reach, player))
+            continue;
+
         player->CheckCollisionPlatform(this, platformHitbox);
 
         switch (player->CheckCollisionBox(this, solidHitbox)) {
@@ -1933,11 +1997,16 @@ void Platform::Collision_Solid_Hurt_All()
     Hitbox *solidHitbox = this->animator.GetHitbox(1);
     int32 stoodPlayers  = this->stoodPlayers;
 
+    CollisionReach reach;
+    SetupReach(&reach, solidHitbox, nullptr);
+
     this->stoodPlayers = 0;
     this->pushPlayersL = 0;
     this->pushPlayersR = 0;
     for (auto player : GameObject::GetEntities<Player>(FOR_ACTIVE_ENTITIES)) {
         uint16 playerID = player->Slot();
+        if (!CheckReach(&reach, player))
+            continue;
 
         switch (player->CheckCollisionBox(this, solidHitbox)) {
             case C_TOP:
@@ -2012,11 +2081,16 @@ void Platform::Collision_Solid_Hurt_NoCrush()
     Hitbox *solidHitbox = this->animator.GetHitbox(1);
     int32 stoodPlayers  = this->stoodPlayers;
 
+    CollisionReach reach;
+    SetupReach(&reach, solidHitbox, nullptr);
+
     this->stoodPlayers = 0;
     this->pushPlayersL = 0;
     this->pushPlayersR = 0;
     for (auto player : GameObject::GetEntities<Player>(FOR_ACTIVE_ENTITIES)) {
         uint16 playerID = player->Slot();
+        if (!CheckReach(&reach, player))
+            continue;
 
         switch (player->CheckCollisionBox(this, solidHitbox)) {
             case C_TOP:
@@ -2233,6 +2307,37 @@ void Platform::HandleStood_Sticky(Player *player, int32 playerID, uint8 cSide)
     }
 }
 
+void Platform::SetupReach(CollisionReach *reach, RSDK::Hitbox *hitboxA, RSDK::Hitbox *hitboxB)
+{
+    // hitboxes flip with the platform's direction, so go by the furthest edge on each axis
+    int32 extentX = 0;
+    int32 extentY = 0;
+
+    Hitbox *hitboxes[2] = { hitboxA, hitboxB };
+    for (int32 h = 0; h < 2; ++h) {
+        if (!hitboxes[h])
+            continue;
+        extentX = MAX(extentX, MAX(abs(hitboxes[h]->left), abs(hitboxes[h]->right)) << 16);
+        extentY = MAX(extentY, MAX(abs(hitboxes[h]->top), abs(hitboxes[h]->bottom)) << 16);
+    }
+
+    reach->left   = this->position.x - extentX - PLATFORM_REACH_MARGIN;
+    reach->top    = this->position.y - extentY - PLATFORM_REACH_MARGIN;
+    reach->right  = this->position.x + extentX + PLATFORM_REACH_MARGIN;
+    reach->bottom = this->position.y + extentY + PLATFORM_REACH_MARGIN;
+}
+
+bool32 Platform::CheckReach(CollisionReach *reach, Player *player)
+{
+    // the same box Player::CheckCollisionBox & co. check with
+    Hitbox *playerHitbox = player->outerBox ? player->outerBox : player->GetHitbox();
+    int32 extentX        = MAX(abs(playerHitbox->left), abs(playerHitbox->right)) << 16;
+    int32 extentY        = MAX(abs(playerHitbox->top), abs(playerHitbox->bottom)) << 16;
+
+    return player->position.x + extentX >= reach->left && player->position.x - extentX <= reach->right && player->position.y + extentY >= reach->top
+           && player->position.y - extentY <= reach->bottom;
+}
+
 #if RETRO_INCLUDE_EDITOR
 void Platform::EditorDraw()
 {
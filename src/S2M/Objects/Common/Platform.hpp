@@ -4,6 +4,9 @@
 
 #include "Global/Player.hpp"
 
+// covers any slack the engine's box & platform checks allow beyond the hitboxes themselves
+#define PLATFORM_REACH_MARGIN (0x200000)
+
 namespace GameLogic
 {
 
@@ -59,6 +62,14 @@ struct Platform : RSDK::GameObject::Entity {
     // STRUCTS
     // ==============================
 
+    // everything a Collision_ callback checks players against, padded out. players outside of it can't be touching the platform
+    struct CollisionReach {
+        int32 left;
+        int32 top;
+        int32 right;
+        int32 bottom;
+    };
+
     // ==============================
     // STATIC VARS
     // ==============================
@@ -185,6 +196,9 @@ struct Platform : RSDK::GameObject::Entity {
     void HandleStood_Barrel(Player *player, int32 playerID, int32 stoodPlayers);
     void HandleStood_Sticky(Player *player, int32 playerID, uint8 cSide);
 
+    void SetupReach(CollisionReach *reach, RSDK::Hitbox *hitboxA, RSDK::Hitbox *hitboxB);
+    static bool32 CheckReach(CollisionReach *reach, Player *player);
+
     // ==============================
     // DECLARATION
     // ==============================
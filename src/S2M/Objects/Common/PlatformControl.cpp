@@ -5,6 +5,7 @@
 // ---------------------------------------------------------------------
 
 #include "PlatformControl.hpp"
+#include "Helpers/LogHelpers.hpp"
 
 using namespace RSDK;
 
@@ -12,16 +13,20 @@ namespace GameLogic
 {
 RSDK_REGISTER_OBJECT(PlatformControl);
 
+// the slots of every controlled platform, each control's run is laid out when it's created so Update doesn't have to hop over children to find them
+static uint16 platformList[SCENEENTITY_COUNT];
+static int32 platformListSize = 0;
+
 void PlatformControl::Update()
 {
     this->active = ACTIVE_NORMAL;
 
-    int32 startNodeSlot = this->Slot() + 1;
-    int32 platformSlot  = startNodeSlot + this->nodeCount;
+    int32 startNodeSlot   = this->Slot() + 1;
+    uint16 *platformSlots = &platformList[this->platformListStart];
 
     if (this->isActive) {
-        for (int32 c = 0; c < this->childCount; ++c) {
-            Platform *platform = GameObject::Get<Platform>(platformSlot);
+        for (int32 c = 0; c < this->platformListCount; ++c) {
+            Platform *platform = GameObject::Get<Platform>(platformSlots[c]);
             PlatformNode *node = GameObject::Get<PlatformNode>(platform->speed);
 
             int32 finishDir = 0;
@@ -99,8 +104,6 @@ void PlatformControl::Update()
 
                 ManagePlatformVelocity(platform, GameObject::Get<PlatformNode>(platform->speed));
             }
-
-            platformSlot += platform->childCount + 1;
         }
     }
     else {
@@ -110,8 +113,8 @@ void PlatformControl::Update()
             this->setActive = true;
 
         if (this->setActive) {
-            for (int32 c = 0; c < this->childCount; ++c) {
-                Platform *platform = GameObject::Get<Platform>(platformSlot);
+            for (int32 c = 0; c < this->platformListCount; ++c) {
+                Platform *platform = GameObject::Get<Platform>(platformSlots[c]);
                 if (platform->state.Matches(&Platform::State_PathStop))
                     platform->state.Set(&Platform::State_Path);
 
@@ -123,7 +126,6 @@ void PlatformControl::Update()
                 platform->speed += startNodeSlot;
                 platform->active = ACTIVE_NORMAL;
                 ManagePlatformVelocity(platform, GameObject::Get<PlatformNode>(platform->speed));
-                platformSlot += platform->childCount + 1;
             }
 
             this->isActive = true;
@@ -134,8 +136,8 @@ void PlatformControl::Update()
         if (this->taggedButton && !this->CheckOnScreen(nullptr) && !this->playingPulleySfx) {
             this->active = ACTIVE_BOUNDS;
 
-            for (int32 c = 0; c < this->childCount; ++c) {
-                Platform *platform = GameObject::Get<Platform>(platformSlot);
+            for (int32 c = 0; c < this->platformListCount; ++c) {
+                Platform *platform = GameObject::Get<Platform>(platformSlots[c]);
                 if (platform->state.Matches(&Platform::State_Path)) {
                     platform->state.Set(&Platform::State_PathStop);
                     platform->speed -= startNodeSlot;
@@ -145,8 +147,6 @@ void PlatformControl::Update()
                 PlatformNode *node = GameObject::Get<PlatformNode>(startNodeSlot);
                 platform->drawPos  = node->position;
                 platform->speed    = 0;
-
-                platformSlot += platform->childCount + 1;
             }
 
             this->hasStopped = false;
@@ -157,15 +157,13 @@ void PlatformControl::Update()
         if (!this->CheckOnScreen(nullptr) && !this->playingPulleySfx) {
             this->active = ACTIVE_BOUNDS;
 
-            int32 slot = startNodeSlot + this->nodeCount;
-            for (int32 c = 0; c < this->childCount; ++c) {
-                Platform *platform = GameObject::Get<Platform>(slot);
+            for (int32 c = 0; c < this->platformListCount; ++c) {
+                Platform *platform = GameObject::Get<Platform>(platformSlots[c]);
                 if (platform->state.Matches(&Platform::State_Path)) {
                     platform->speed -= startNodeSlot;
                     platform->state.Set(&Platform::State_PathStop);
                     platform->active = ACTIVE_BOUNDS;
                 }
-                slot += platform->childCount + 1;
             }
 
             this->isActive = false;
@@ -197,6 +195,32 @@ void PlatformControl::Create(void *data)
                 this->updateRange.y = abs(node->position.y - this->position.y);
         }
 
+        // Create can run again for the same control (a reset or a restored copy), which keeps using the run it was given the first time
+        this->platformListStart = platformListSize;
+        this->platformListCount = 0;
+        for (int32 i = 0; i < platformListSize && this->childCount; ++i) {
+            if (platformList[i] == id) {
+                this->platformListStart = i;
+                this->platformListCount = MIN(this->childCount, platformListSize - i);
+                break;
+            }
+        }
+
+        // each controlled platform is followed by its own children, so hop over those to reach the next one
+        if (this->platformListStart == platformListSize) {
+            for (int32 c = 0, slot = id; c < this->childCount; ++c) {
+                if (platformListSize >= SCENEENTITY_COUNT) {
+                    LOG_PRINT("PlatformControl: platform list is full, control in slot %d only moves %d of its %d platforms", this->Slot(),
+                              this->platformListCount, this->childCount);
+                    break;
+                }
+
+                platformList[platformListSize++] = slot;
+                this->platformListCount++;
+                slot += GameObject::Get<Platform>(slot)->childCount + 1;
+            }
+        }
+
         if (!this->speed)
             this->speed = 4;
 
@@ -234,7 +258,12 @@ void PlatformControl::Create(void *data)
     }
 }
 
-void PlatformControl::StageLoad() { sVars->aniFrames.Load("Editor/EditorIcons.bin", SCOPE_STAGE); }
+void PlatformControl::StageLoad()
+{
+    sVars->aniFrames.Load("Editor/EditorIcons.bin", SCOPE_STAGE);
+
+    platformListSize = 0;
+}
 
 void PlatformControl::ManagePlatformVelocity(Platform *platform, PlatformNode *node)
 {
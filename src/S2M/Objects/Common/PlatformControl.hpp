@@ -47,6 +47,8 @@ struct PlatformControl : RSDK::GameObject::Entity {
     bool32 hasStopped;
     bool32 resetOffScreen;
     bool32 playingPulleySfx;
+    int32 platformListStart;
+    int32 platformListCount;
 
     // ==============================
     // EVENTS
@@ -369,7 +369,7 @@ void ScreenWrap::State_Vertical()
                     trail->position.y -= this->buffer.x;
                     trail->lastPos.y -= this->buffer.x;
 
-                    for (int32 i = 0; i < IMAGETRAIL_TRACK_COUNT; ++i) trail->statePos[i].y -= this->buffer.x;
+                    for (int32 i = 0; i < IMAGETRAIL_TRACK_COUNT; ++i) trail->GetRecord(i + 1)->position.y -= this->buffer.x;
                 }
 
                 for (auto sparkle : GameObject::GetEntities<SuperSparkle>(FOR_ALL_ENTITIES)) {
@@ -386,7 +386,7 @@ void ScreenWrap::State_Vertical()
                     trail->position.y += this->buffer.x;
                     trail->lastPos.y += this->buffer.x;
 
-                    for (int32 i = 0; i < IMAGETRAIL_TRACK_COUNT; ++i) trail->statePos[i].y += this->buffer.x;
+                    for (int32 i = 0; i < IMAGETRAIL_TRACK_COUNT; ++i) trail->GetRecord(i + 1)->position.y += this->buffer.x;
                 }
 
                 for (auto sparkle : GameObject::GetEntities<SuperSparkle>(FOR_ALL_ENTITIES)) {
@@ -407,13 +407,13 @@ void ScreenWrap::State_Vertical()
                             HandleVWrap(false, 1);
                             this->vWrapMode  = 1;
                             this->vWrapState = 1;
-                            LogHelpers::PrintText("FROM ABOVE: WRAP ENTITIES DOWN");
+                            LOG_PRINT_TEXT_VERBOSE("FROM ABOVE: WRAP ENTITIES DOWN");
                         }
                         else if (player1->position.y <= this->buffer.y + (this->buffer.y >> 1)) {
                             HandleVWrap(true, 1);
                             this->vWrapMode  = 1;
                             this->vWrapState = 2;
-                            LogHelpers::PrintText("FROM BELOW: WRAP ENTITIES UP");
+                            LOG_PRINT_TEXT_VERBOSE("FROM BELOW: WRAP ENTITIES UP");
                         }
                     }
                     break;
@@ -435,7 +435,7 @@ void ScreenWrap::State_Vertical()
                                     trail->position.y -= this->buffer.x;
                                     trail->lastPos.y -= this->buffer.x;
 
-                                    for (int32 i = 0; i < IMAGETRAIL_TRACK_COUNT; ++i) trail->statePos[i].y -= this->buffer.x;
+                                    for (int32 i = 0; i < IMAGETRAIL_TRACK_COUNT; ++i) trail->GetRecord(i + 1)->position.y -= this->buffer.x;
                                 }
 
                                 for (auto sparkle : GameObject::GetEntities<SuperSparkle>(FOR_ALL_ENTITIES)) {
@@ -446,13 +446,13 @@ void ScreenWrap::State_Vertical()
                                 sVars->stateWrapUp.Run(this);
 
                                 this->vWrapMode = 2;
-                                LogHelpers::PrintText("FROM ABOVE: WRAP PLAYER UP");
+                                LOG_PRINT_TEXT_VERBOSE("FROM ABOVE: WRAP PLAYER UP");
                             }
                             else if (player1->position.y <= this->buffer.x - (this->buffer.y >> 1)) {
                                 HandleVWrap(true, 0);
                                 this->vWrapMode  = 0;
                                 this->vWrapState = 0;
-                                LogHelpers::PrintText("FROM ABOVE: WRAP ENTITIES UP");
+                                LOG_PRINT_TEXT_VERBOSE("FROM ABOVE: WRAP ENTITIES UP");
                             }
                             break;
 
@@ -469,7 +469,7 @@ void ScreenWrap::State_Vertical()
                                     trail->position.y += this->buffer.x;
                                     trail->lastPos.y += this->buffer.x;
 
-                                    for (int32 i = 0; i < IMAGETRAIL_TRACK_COUNT; ++i) trail->statePos[i].y += this->buffer.x;
+                                    for (int32 i = 0; i < IMAGETRAIL_TRACK_COUNT; ++i) trail->GetRecord(i + 1)->position.y += this->buffer.x;
                                 }
 
                                 for (auto sparkle : GameObject::GetEntities<SuperSparkle>(FOR_ALL_ENTITIES)) {
@@ -479,13 +479,13 @@ void ScreenWrap::State_Vertical()
                                 HandleVWrap(false, 1);
                                 sVars->stateWrapDown.Run(this);
                                 this->vWrapMode = 2;
-                                LogHelpers::PrintText("FROM BELOW: WRAP PLAYER DOWN");
+                                LOG_PRINT_TEXT_VERBOSE("FROM BELOW: WRAP PLAYER DOWN");
                             }
                             else if (player1->position.y > this->buffer.y + (this->buffer.y >> 1)) {
                                 HandleVWrap(false, 0);
                                 this->vWrapMode  = 0;
                                 this->vWrapState = 0;
-                                LogHelpers::PrintText("FROM BELOW: WRAP ENTITIES DOWN");
+                                LOG_PRINT_TEXT_VERBOSE("FROM BELOW: WRAP ENTITIES DOWN");
                             }
                             break;
                     }
@@ -499,12 +499,12 @@ void ScreenWrap::State_Vertical()
                             if (player1->position.y >= this->buffer.y + (this->buffer.y >> 1)) {
                                 this->vWrapMode  = 0;
                                 this->vWrapState = 0;
-                                LogHelpers::PrintText("FROM ABOVE: COMPLETE");
+                                LOG_PRINT_TEXT_VERBOSE("FROM ABOVE: COMPLETE");
                             }
                             else if (player1->position.y <= this->buffer.y - (this->buffer.y >> 1)) {
                                 this->vWrapMode  = 1;
                                 this->vWrapState = 1;
-                                LogHelpers::PrintText("FROM ABOVE: RETURN");
+                                LOG_PRINT_TEXT_VERBOSE("FROM ABOVE: RETURN");
                             }
                             break;
 
@@ -512,12 +512,12 @@ void ScreenWrap::State_Vertical()
                             if (player1->position.y <= this->buffer.x - (this->buffer.y / 2)) {
                                 this->vWrapMode  = 0;
                                 this->vWrapState = 0;
-                                LogHelpers::PrintText("FROM BELOW: COMPLETE");
+                                LOG_PRINT_TEXT_VERBOSE("FROM BELOW: COMPLETE");
                             }
                             else if (player1->position.y >= this->buffer.x + (this->buffer.y / 2)) {
                                 this->vWrapMode  = 1;
                                 this->vWrapState = 2;
-                                LogHelpers::PrintText("FROM BELOW: RETURN");
+                                LOG_PRINT_TEXT_VERBOSE("FROM BELOW: RETURN");
                             }
                             break;
                     }
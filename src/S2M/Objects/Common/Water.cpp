@@ -19,10 +19,23 @@ namespace GameLogic
 {
 RSDK_REGISTER_OBJECT(Water);
 
+// type -> registry lookup, -1 for types nothing searches for
+static const int8 registryForType[] = {
+    -1,                            // WaterLevel
+    Water::RegistryPools,          // Pool
+    Water::RegistryBubblers,       // Bubbler
+    Water::RegistryHeightTriggers, // HeightTrigger
+    -1,                            // Splash
+    Water::RegistryBubbles,        // Bubble
+    Water::RegistryCountdowns,     // Countdown
+};
+
 void Water::Update() { this->state.Run(this); }
 void Water::LateUpdate() {}
 void Water::StaticUpdate()
 {
+    PruneRegistries();
+
     PauseMenu *pauseMenu = GameObject::Get<PauseMenu>(SLOT_PAUSEMENU);
 
     if (pauseMenu->classID != PauseMenu::sVars->classID) {
@@ -34,7 +47,7 @@ void Water::StaticUpdate()
             sVars->waterLevelVolume = CLAMP(sVars->waterLevelVolume, 0, 30);
         }
         else {
-            if (Stage::CheckSceneFolder("HCZ") && sVars->moveWaterLevel) {
+            if (Zone::SceneFolder() == SceneIdentity::FolderHCZ && sVars->moveWaterLevel) {
                 ++sVars->waterLevelVolume;
             }
 
@@ -221,6 +234,8 @@ void Water::Create(void *data)
 
             default: break;
         }
+
+        Register();
     }
 }
 
@@ -228,6 +243,9 @@ void Water::StageLoad()
 {
     sVars->active = ACTIVE_ALWAYS;
 
+    memset(sVars->registryCount, 0, sizeof(sVars->registryCount));
+    memset(sVars->registryMask, 0, sizeof(sVars->registryMask));
+
     sVars->aniFrames.Load("Global/Water.bin", SCOPE_STAGE);
 
     sVars->waterLevel       = 0x7FFFFFFF;
@@ -254,7 +272,7 @@ void Water::StageLoad()
     sVars->sfxDrownAlert.Get("Stage/DrownAlert.wav");
     sVars->sfxSkim.Get("HCZ/Skim.wav");
 
-    if (Stage::CheckSceneFolder("HCZ")) {
+    if (Zone::SceneFolder() == SceneIdentity::FolderHCZ) {
         sVars->wakeFrames.Load("HCZ/Wake.bin", SCOPE_STAGE);
 
         sVars->sfxWaterLevelL.Get("HCZ/WaterLevel_L.wav");
@@ -300,6 +318,58 @@ void Water::SetupTagLink()
     }
 }
 
+void Water::Register()
+{
+    if (this->type >= sizeof(registryForType) / sizeof(registryForType[0]) || registryForType[this->type] < 0)
+        return;
+
+    int32 registry = registryForType[this->type];
+    uint16 slot    = this->Slot();
+
+    // slot may still be listed from a previous occupant of the same type that was never pruned
+    if (sVars->registryMask[slot] & (1 << registry))
+        return;
+
+    sVars->registryMask[slot] |= 1 << registry;
+
+    // keep the list in slot order so searches visit entities in the same order FOR_ACTIVE_ENTITIES did
+    uint16 *slots = sVars->registrySlots[registry];
+    int32 id      = sVars->registryCount[registry]++;
+    for (; id > 0 && slots[id - 1] > slot; --id) slots[id] = slots[id - 1];
+    slots[id] = slot;
+}
+
+void Water::PruneRegistries()
+{
+    // entities are destroyed without notifying us, so drop any slot that no longer holds a water of the listed type
+    for (int32 r = 0; r < RegistryCount; ++r) {
+        int32 count = 0;
+        for (int32 i = 0; i < sVars->registryCount[r]; ++i) {
+            uint16 slot = sVars->registrySlots[r][i];
+            if (GetRegistered(r, i, false))
+                sVars->registrySlots[r][count++] = slot;
+            else
+                sVars->registryMask[slot] &= ~(1 << r);
+        }
+        sVars->registryCount[r] = count;
+    }
+}
+
+Water *Water::GetRegistered(uint8 registry, int32 id, bool32 activeOnly)
+{
+    Water *water = GameObject::Get<Water>(sVars->registrySlots[registry][id]);
+
+    if (water->classID != sVars->classID || water->type >= sizeof(registryForType) / sizeof(registryForType[0])
+        || registryForType[water->type] != registry)
+        return nullptr;
+
+    // matches what FOR_ACTIVE_ENTITIES would have visited this frame
+    if (activeOnly && !water->inRange)
+        return nullptr;
+
+    return water;
+}
+
 void Water::SpawnBubble(Player *player, int32 id)
 {
     if (sVars->constBubbleTimer[id] <= 0) {
@@ -376,18 +446,20 @@ void Water::State_Water()
         if (canEnterWater) {
             Water *waterPtr   = nullptr;
             uint16 underwater = 0;
-            for (auto pool : GameObject::GetEntities<Water>(FOR_ACTIVE_ENTITIES)) {
-                if (pool->type == Water::Pool) {
-                    if (pool->CheckCollisionTouchBox(&pool->hitbox, player, &sVars->hitboxPoint)) {
-                        waterPtr       = pool;
-                        pool->childPtr = player;
-                        underwater     = pool->Slot();
-                    }
-                    else if (pool->childPtr == player) {
-                        pool->childPtr = nullptr;
-                        if (!waterPtr)
-                            waterPtr = pool;
-                    }
+            for (int32 i = 0; i < sVars->registryCount[RegistryPools]; ++i) {
+                Water *pool = GetRegistered(RegistryPools, i, true);
+                if (!pool)
+                    continue;
+
+                if (pool->CheckCollisionTouchBox(&pool->hitbox, player, &sVars->hitboxPoint)) {
+                    waterPtr       = pool;
+                    pool->childPtr = player;
+                    underwater     = pool->Slot();
+                }
+                else if (pool->childPtr == player) {
+                    pool->childPtr = nullptr;
+                    if (!waterPtr)
+                        waterPtr = pool;
                 }
             }
 
@@ -427,8 +499,9 @@ void Water::State_Water()
                             sVars->sfxSplash.Play();
                         }
 
-                        for (auto countdown : GameObject::GetEntities<Water>(FOR_ALL_ENTITIES)) {
-                            if (countdown->type == Water::Countdown && countdown->childPtr == player) {
+                        for (int32 i = 0; i < sVars->registryCount[RegistryCountdowns]; ++i) {
+                            Water *countdown = GetRegistered(RegistryCountdowns, i, false);
+                            if (countdown && countdown->childPtr == player) {
                                 countdown->Destroy();
                             }
                         }
@@ -667,8 +740,9 @@ void Water::BubbleFloatBehavior()
 
     if (this->position.y < sVars->waterLevel) {
         bool32 inWater = false;
-        for (auto pool : GameObject::GetEntities<Water>(FOR_ACTIVE_ENTITIES)) {
-            if (pool->type == Water::Pool && pool->CheckCollisionTouchBox(&pool->hitbox, this, &sVars->hitboxPoint))
+        for (int32 i = 0; i < sVars->registryCount[RegistryPools] && !inWater; ++i) {
+            Water *pool = GetRegistered(RegistryPools, i, true);
+            if (pool && pool->CheckCollisionTouchBox(&pool->hitbox, this, &sVars->hitboxPoint))
                 inWater = true;
         }
 
@@ -686,11 +760,13 @@ void Water::BubbleFloatBehavior()
 
 void Water::ApplyHeightTriggers()
 {
-    for (auto trigger : GameObject::GetEntities<Water>(FOR_ACTIVE_ENTITIES)) {
-        if (trigger->type == Water::HeightTrigger)
+    for (int32 i = 0; i < sVars->registryCount[RegistryHeightTriggers]; ++i) {
+        Water *trigger = GetRegistered(RegistryHeightTriggers, i, true);
+        if (trigger)
             trigger->State_HeightTrigger();
-        sVars->waterLevel = sVars->targetWaterLevel;
     }
+
+    sVars->waterLevel = sVars->targetWaterLevel;
 }
 
 void Water::BubbleFinishPopBehavior()
@@ -849,8 +925,9 @@ void Water::State_Bubbler()
     if (this->position.y > sVars->waterLevel)
         this->visible = true;
 
-    for (auto pool : GameObject::GetEntities<Water>(FOR_ACTIVE_ENTITIES)) {
-        if (pool->type == Water::Pool && pool->CheckCollisionTouchBox(&pool->hitbox, this, &sVars->hitboxPoint))
+    for (int32 i = 0; i < sVars->registryCount[RegistryPools] && !this->visible; ++i) {
+        Water *pool = GetRegistered(RegistryPools, i, true);
+        if (pool && pool->CheckCollisionTouchBox(&pool->hitbox, this, &sVars->hitboxPoint))
             this->visible = true;
     }
 
@@ -927,8 +1004,9 @@ void Water::State_Countdown()
         isActive = true;
     }
     else {
-        for (auto pool : GameObject::GetEntities<Water>(FOR_ACTIVE_ENTITIES)) {
-            if (pool->type == Water::Pool && pool->CheckCollisionTouchBox(&pool->hitbox, this, &sVars->hitboxPoint)) {
+        for (int32 i = 0; i < sVars->registryCount[RegistryPools] && !isActive; ++i) {
+            Water *pool = GetRegistered(RegistryPools, i, true);
+            if (pool && pool->CheckCollisionTouchBox(&pool->hitbox, this, &sVars->hitboxPoint)) {
                 isActive = true;
             }
         }
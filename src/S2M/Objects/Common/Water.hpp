@@ -3,6 +3,9 @@
 
 #include "Global/Player.hpp"
 
+// one slot per entity, so a registry can never overflow
+#define WATER_REGISTRY_SIZE (ENTITY_COUNT)
+
 namespace GameLogic
 {
 
@@ -29,6 +32,15 @@ struct Water : RSDK::GameObject::Entity {
         PriorityHighest,
     };
 
+    enum Registries {
+        RegistryPools,
+        RegistryHeightTriggers,
+        RegistryBubbles,
+        RegistryBubblers,
+        RegistryCountdowns,
+        RegistryCount,
+    };
+
     // ==============================
     // STRUCTS
     // ==============================
@@ -75,6 +87,9 @@ struct Water : RSDK::GameObject::Entity {
         RSDK::Animator wakeAnimator;
         int32 unused3;
         bool32 playingSkimSfx;
+        uint16 registrySlots[RegistryCount][WATER_REGISTRY_SIZE];
+        int32 registryCount[RegistryCount];
+        uint8 registryMask[WATER_REGISTRY_SIZE];
     };
 
     // ==============================
@@ -140,6 +155,9 @@ struct Water : RSDK::GameObject::Entity {
 
     // Utils
     void SetupTagLink();
+    void Register();
+    static void PruneRegistries();
+    static Water *GetRegistered(uint8 registry, int32 id, bool32 activeOnly);
     static void SpawnBubble(Player *player, int32 id);
     static void SpawnCountDownBubble(Player *player, int32 id, uint8 bubbleID);
     void BubbleFloatBehavior();
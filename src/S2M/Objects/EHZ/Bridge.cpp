@@ -55,33 +55,29 @@ void Bridge::StaticUpdate() {}
 
 void Bridge::Draw()
 {
+    Bridge::UpdateSagTable();
+
     int32 id = 0;
     Vector2 drawPos;
 
     int32 size = this->stoodPos >> 20;
-    int32 ang  = 0x80000;
     drawPos.x  = this->startPos + 0x80000;
-    for (int32 i = 0; i < size; ++i) {
-        drawPos.y = (this->bridgeDepth * Math::Sin512((ang << 7) / this->stoodPos) >> 9) + this->position.y;
+    for (; id < size; ++id) {
+        drawPos.y = this->logHeights[id] + this->position.y;
         this->animator.DrawSprite(&drawPos, false);
         drawPos.x += 0x100000;
-        ang += 0x100000;
     }
-    id = size;
 
     drawPos.y = this->bridgeDepth + this->position.y;
     this->animator.DrawSprite(&drawPos, false);
     drawPos.x += 0x100000;
     ++id;
 
-    ang           = 0x80000;
-    int32 divisor = this->endPos - this->startPos - this->stoodPos;
-    drawPos.x     = this->endPos - 0x80000;
-    for (; id < this->length; ++id) {
-        drawPos.y = (this->bridgeDepth * Math::Sin512((ang << 7) / divisor) >> 9) + this->position.y;
+    drawPos.x = this->endPos - 0x80000;
+    for (int32 l = this->length - 1; id < this->length; ++id, --l) {
+        drawPos.y = this->logHeights[l] + this->position.y;
         this->animator.DrawSprite(&drawPos, false);
         drawPos.x -= 0x100000;
-        ang += 0x100000;
     }
 }
 
@@ -89,7 +85,7 @@ void Bridge::Create(void *data)
 {
     if (!sceneInfo->inEditor) {
         this->visible = true;
-        ++this->length;
+        this->length  = MIN(this->length + 1, BRIDGE_LOG_COUNT);
         this->drawGroup     = Zone::sVars->objectDrawGroup[0];
         this->active        = ACTIVE_BOUNDS;
         int32 len           = this->length << 19;
@@ -99,19 +95,21 @@ void Bridge::Create(void *data)
         this->updateRange.y = 0x800000;
         this->stoodEntity   = (Entity *)-1;
         this->burnOffset    = 0xFF;
+        this->sagStoodPos   = -1;
+        this->sagTablePos   = -1;
         this->animator.SetAnimation(sVars->aniFrames, 0, true, 0);
     }
 }
 
 void Bridge::StageLoad()
 {
-    if (Stage::CheckSceneFolder("EHZ") || Stage::CheckSceneFolder("EEHZ")) {
+    if (Zone::SceneFolder() == SceneIdentity::FolderEHZ || Zone::SceneFolder() == SceneIdentity::FolderEEHZ) {
         sVars->aniFrames.Load("EHZ/Bridge.bin", SCOPE_STAGE);
     }
-    else if (Stage::CheckSceneFolder("HPZ") || Stage::CheckSceneFolder("PPZ")) {
+    else if (Zone::SceneFolder() == SceneIdentity::FolderHPZ || Zone::SceneFolder() == SceneIdentity::FolderPPZ) {
         sVars->aniFrames.Load("HPZ/Bridge.bin", SCOPE_STAGE);
     }
-    else if (Stage::CheckSceneFolder("HEHZ")) {
+    else if (Zone::SceneFolder() == SceneIdentity::FolderHEHZ) {
         sVars->aniFrames.Load("HEHZ/Bridge.bin", SCOPE_STAGE);
     }
 
@@ -126,31 +124,76 @@ void Bridge::DebugDraw()
 
 void Bridge::DebugSpawn() { GameObject::Create<Bridge>(nullptr, this->position.x, this->position.y); }
 
+// n / d for a non-negative n, using a reciprocal of d and a correction step instead of a divide. matches the plain division exactly
+static inline int32 DivideSag(int32 n, int32 d, uint32 recip)
+{
+    if (n < 0 || !recip)
+        return n / d;
+
+    int32 q = (int32)(((uint64)(uint32)n * recip) >> 32);
+    while (n - q * d >= d) ++q;
+    return q;
+}
+
+void Bridge::UpdateSagDivisors()
+{
+    if (this->sagStoodPos == this->stoodPos)
+        return;
+
+    // the logs left of stoodPos sag over stoodPos, the ones right of it over the rest of the span
+    int32 divisor     = this->endPos - this->startPos - this->stoodPos;
+    this->sagRecip[0] = this->stoodPos > 0 ? 0xFFFFFFFF / (uint32)this->stoodPos : 0;
+    this->sagRecip[1] = divisor > 0 ? 0xFFFFFFFF / (uint32)divisor : 0;
+    this->sagStoodPos = this->stoodPos;
+}
+
+void Bridge::UpdateSagTable()
+{
+    Bridge::UpdateSagDivisors();
+
+    if (this->sagTablePos == this->stoodPos && this->sagTableDepth == this->bridgeDepth)
+        return;
+
+    int32 size = this->stoodPos >> 20;
+    int32 ang  = 0x80000;
+    for (int32 i = 0; i < size; ++i) {
+        this->logHeights[i] = this->bridgeDepth * Math::Sin512(DivideSag(ang << 7, this->stoodPos, this->sagRecip[0])) >> 9;
+        ang += 0x100000;
+    }
+
+    this->logHeights[size] = this->bridgeDepth;
+
+    ang           = 0x80000;
+    int32 divisor = this->endPos - this->startPos - this->stoodPos;
+    for (int32 i = this->length - 1; i > size; --i) {
+        this->logHeights[i] = this->bridgeDepth * Math::Sin512(DivideSag(ang << 7, divisor, this->sagRecip[1])) >> 9;
+        ang += 0x100000;
+    }
+
+    this->sagTablePos   = this->stoodPos;
+    this->sagTableDepth = this->bridgeDepth;
+}
+
 void Bridge::Burn(int32 offset)
 {
+    Bridge::UpdateSagTable();
+
     int32 size   = this->stoodPos >> 20;
     int32 spawnX = this->startPos + 0x80000;
     int32 off    = -offset;
-    int32 ang    = 0x80000;
     for (int32 i = 0; i < size; ++i) {
-        int32 sine = Math::Sin512((ang << 7) / this->stoodPos);
-        GameObject::Create<BurningLog>(INT_TO_VOID(8 * abs(off++) + 16), spawnX, (this->bridgeDepth * sine >> 9) + this->position.y);
-        ang += 0x100000;
+        GameObject::Create<BurningLog>(INT_TO_VOID(8 * abs(off++) + 16), spawnX, this->logHeights[i] + this->position.y);
         spawnX += 0x100000;
     }
 
     int32 id = size;
     GameObject::Create<BurningLog>(INT_TO_VOID(8 * abs(id++ - offset) + 16), spawnX, this->bridgeDepth + this->position.y);
 
-    spawnX        = this->endPos - 0x80000;
-    int32 divisor = this->endPos - this->startPos - this->stoodPos;
-    ang           = 0x80000;
+    spawnX = this->endPos - 0x80000;
     if (id < this->length) {
         off = offset - id;
-        for (; id < this->length; ++id, --off) {
-            int32 spawnY = (this->bridgeDepth * Math::Sin512((ang << 7) / divisor) >> 9) + this->position.y;
-            GameObject::Create<BurningLog>(INT_TO_VOID(8 * abs(this->length - abs(off) - offset) + 16), spawnX, spawnY);
-            ang += 0x100000;
+        for (int32 l = this->length - 1; id < this->length; ++id, --off, --l) {
+            GameObject::Create<BurningLog>(INT_TO_VOID(8 * abs(this->length - abs(off) - offset) + 16), spawnX, this->logHeights[l] + this->position.y);
             spawnX -= 0x100000;
         }
     }
@@ -177,18 +220,23 @@ bool32 Bridge::HandleCollisions(void *e, Bridge *self, Hitbox *entityHitbox, boo
                 hitboxBridge.left  = -0x400;
                 hitboxBridge.right = 0x400;
 
+                self->UpdateSagDivisors();
+
                 int32 divisor = 0;
                 int32 ang     = 0;
+                uint32 recip  = 0;
                 if (entity->position.x - self->startPos <= self->stoodPos) {
                     divisor = self->stoodPos;
                     ang     = (entity->position.x - self->startPos) << 7;
+                    recip   = self->sagRecip[0];
                 }
                 else {
                     divisor = self->endPos - self->startPos - self->stoodPos;
                     ang     = (self->endPos - entity->position.x) << 7;
+                    recip   = self->sagRecip[1];
                 }
 
-                int32 hitY = (self->bridgeDepth * Math::Sin512(ang / divisor) >> 9) - 0x80000;
+                int32 hitY = (self->bridgeDepth * Math::Sin512(DivideSag(ang, divisor, recip)) >> 9) - 0x80000;
                 if (entity->velocity.y >= 0x8000) {
                     hitboxBridge.top    = (hitY >> 16);
                     hitboxBridge.bottom = hitboxBridge.top + 8;
@@ -298,7 +346,10 @@ bool32 Bridge::HandleCollisions(void *e, Bridge *self, Hitbox *entityHitbox, boo
 #if RETRO_INCLUDE_EDITOR
 void Bridge::EditorDraw()
 {
-    int32 length = this->length++;
+    int32 length      = this->length;
+    this->length      = MIN(this->length + 1, BRIDGE_LOG_COUNT);
+    this->sagStoodPos = -1;
+    this->sagTablePos = -1;
 
     int32 len           = this->length << 19;
     this->startPos      = this->position.x - len;
@@ -313,10 +364,10 @@ void Bridge::EditorDraw()
 
 void Bridge::EditorLoad()
 {
-    if (Stage::CheckSceneFolder("EHZ")) {
+    if (Zone::SceneFolder() == SceneIdentity::FolderEHZ) {
         sVars->aniFrames.Load("EHZ/Bridge.bin", SCOPE_STAGE);
     }
-    else if (Stage::CheckSceneFolder("HPZ") || Stage::CheckSceneFolder("PPZ")) {
+    else if (Zone::SceneFolder() == SceneIdentity::FolderHPZ || Zone::SceneFolder() == SceneIdentity::FolderPPZ) {
         sVars->aniFrames.Load("HPZ/Bridge.bin", SCOPE_STAGE);
     }
 }
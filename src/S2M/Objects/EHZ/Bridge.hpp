@@ -1,6 +1,9 @@
 #pragma once
 #include "S2M.hpp"
 
+// the sag maths already overflows well before this many logs, so it's the most a bridge can have
+#define BRIDGE_LOG_COUNT (0x40)
+
 namespace GameLogic
 {
 struct Bridge : RSDK::GameObject::Entity {
@@ -21,6 +24,11 @@ struct Bridge : RSDK::GameObject::Entity {
     int32 startPos;
     int32 endPos;
     RSDK::Animator animator;
+    int32 sagStoodPos;
+    uint32 sagRecip[2];
+    int32 sagTablePos;
+    int32 sagTableDepth;
+    int32 logHeights[BRIDGE_LOG_COUNT];
 
     // EVENTS //
 
@@ -42,6 +50,9 @@ struct Bridge : RSDK::GameObject::Entity {
     void DebugDraw();
     void DebugSpawn();
 
+    void UpdateSagDivisors();
+    void UpdateSagTable();
+
     void Burn(int32 offset);
     bool32 HandleCollisions(void *e, Bridge *self, RSDK::Hitbox *entityHitbox, bool32 updateVars, bool32 isPlayer);
 
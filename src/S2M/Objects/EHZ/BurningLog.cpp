@@ -61,10 +61,10 @@ void BurningLog::Create(void *data)
 
 void BurningLog::StageLoad()
 {
-    if (Stage::CheckSceneFolder("EHZ")) {
+    if (Zone::SceneFolder() == SceneIdentity::FolderEHZ) {
         sVars->aniFrames.Load("EHZ/Fireball.bin", SCOPE_STAGE);
     }
-    else if (Stage::CheckSceneFolder("HEHZ")) {
+    else if (Zone::SceneFolder() == SceneIdentity::FolderHEHZ) {
         sVars->aniFrames.Load("HEHZ/Fireball.bin", SCOPE_STAGE);
     }
 
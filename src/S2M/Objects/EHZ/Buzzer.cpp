@@ -66,10 +66,10 @@ void Buzzer::Create(void *data)
 
 void Buzzer::StageLoad()
 {
-    if (Stage::CheckSceneFolder("EHZ")) {
+    if (Zone::SceneFolder() == SceneIdentity::FolderEHZ) {
         sVars->aniFrames.Load("EHZ/Buzzer.bin", SCOPE_STAGE);
     }
-    else if (Stage::CheckSceneFolder("HEHZ")) {
+    else if (Zone::SceneFolder() == SceneIdentity::FolderHEHZ) {
         sVars->aniFrames.Load("HEHZ/Buzzer.bin", SCOPE_STAGE);
     }
 
@@ -58,10 +58,10 @@ void Coconuts::Create(void* data)
 
 void Coconuts::StageLoad()
 {
-    if (Stage::CheckSceneFolder("EHZ")) {
+    if (Zone::SceneFolder() == SceneIdentity::FolderEHZ) {
         sVars->aniFrames.Load("EHZ/Coconuts.bin", SCOPE_STAGE);
     }
-    else if (Stage::CheckSceneFolder("HEHZ")) {
+    else if (Zone::SceneFolder() == SceneIdentity::FolderHEHZ) {
         sVars->aniFrames.Load("HEHZ/Coconuts.bin", SCOPE_STAGE);
     }
 
@@ -278,7 +278,7 @@ void Coconuts::EditorDraw()
 
 void Coconuts::EditorLoad()
 {
-    if (Stage::CheckSceneFolder("EHZ"))
+    if (Zone::SceneFolder() == SceneIdentity::FolderEHZ)
         sVars->aniFrames.Load("EHZ/Coconuts.bin", SCOPE_STAGE);
 
     RSDK_ACTIVE_VAR(sVars, direction);
@@ -109,10 +109,10 @@ void EHZSetup::StageLoad()
                 characterText  = "Knuckles";
                 break;
         }
-        if (Stage::CheckSceneFolder("EHZ")) {
+        if (Zone::SceneFolder() == SceneIdentity::FolderEHZ) {
             SetPresence(playingAsText, "In Emerald Hill", "ehz", "Emerald Hill", characterImage, characterText);
         }
-        else if (Stage::CheckSceneFolder("HEHZ")) {
+        else if (Zone::SceneFolder() == SceneIdentity::FolderHEHZ) {
             SetPresence(playingAsText, "In H. Emerald Hill", "hehz", "H. Emerald Hill", characterImage, characterText);
         }
     }
@@ -129,7 +129,7 @@ void EHZSetup::StageFinish_EndAct1()
     Vector2 offset(TO_FIXED(Zone::sVars->cameraBoundsL[0] + screenInfo->center.x), TO_FIXED(Zone::sVars->cameraBoundsB[0]));
     Zone::StoreEntities(offset);
 
-    if (Stage::CheckSceneFolder("HEHZ")) {
+    if (Zone::SceneFolder() == SceneIdentity::FolderHEHZ) {
         // copy first Snowflakes (should be the only Snowflakes)
         Snowflakes *snowflake = *GameObject::GetEntities<Snowflakes>(RSDK::FOR_ACTIVE_ENTITIES).begin();
         sVars->snowflakeCount = Snowflakes::sVars->count;
@@ -154,7 +154,7 @@ void EHZSetup::HandleActTransition()
     Zone::ReloadEntities(Vector2(TO_FIXED(256), TO_FIXED(694)), true);
     Zone::sVars->timer = sVars->timerStorage;
 
-    if (Stage::CheckSceneFolder("HEHZ")) {
+    if (Zone::SceneFolder() == SceneIdentity::FolderHEHZ) {
         Camera *camera = GameObject::Get<Camera>(SLOT_CAMERA1);
         camera->SetCameraBoundsXY(); // force screen pos, this doesn't cause any artifacts thankfully
 
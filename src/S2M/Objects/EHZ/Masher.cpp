@@ -43,10 +43,10 @@ void Masher::Create(void* data)
 
 void Masher::StageLoad()
 {
-    if (Stage::CheckSceneFolder("EHZ")) {
+    if (Zone::SceneFolder() == SceneIdentity::FolderEHZ) {
         sVars->aniFrames.Load("EHZ/Masher.bin", SCOPE_STAGE);
     }
-    else if (Stage::CheckSceneFolder("HEHZ")) {
+    else if (Zone::SceneFolder() == SceneIdentity::FolderHEHZ) {
         sVars->aniFrames.Load("HEHZ/Masher.bin", SCOPE_STAGE);
     }
 
@@ -107,7 +107,7 @@ void Masher::EditorDraw()
 
 void Masher::EditorLoad()
 {
-    if (Stage::CheckSceneFolder("EHZ"))
+    if (Zone::SceneFolder() == SceneIdentity::FolderEHZ)
         sVars->aniFrames.Load("EHZ/Masher.bin", SCOPE_STAGE);
 }
 #endif
@@ -352,7 +352,7 @@ void ActClear::Create(void *data)
 
         for (auto player : GameObject::GetEntities<Player>(RSDK::FOR_ACTIVE_ENTITIES)) {
             if (player->invincibleTimer > 32) {
-                player->invincibleTimer = 32;
+                player->SetInvincibleTimer(32);
             }
         }
     }
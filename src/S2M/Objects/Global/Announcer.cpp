@@ -5,6 +5,7 @@
 // ---------------------------------------------------------------------
 
 #include "Announcer.hpp"
+#include "Zone.hpp"
 #include "Helpers/LogHelpers.hpp"
 #include "Helpers/MathHelpers.hpp"
 
@@ -48,7 +49,7 @@ void Announcer::StageLoad()
         sVars->finishedCountdown = false;
     }
 
-    if (Stage::CheckSceneFolder("Menu")) {
+    if (Zone::SceneFolder() == SceneIdentity::FolderMenu) {
         sVars->sfxSonic.Get("VO/Sonic.wav");
         sVars->sfxTails.Get("VO/Tails.wav");
         sVars->sfxKnuckles.Get("VO/Knuckles.wav");
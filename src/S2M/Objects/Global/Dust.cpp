@@ -26,6 +26,8 @@ void Dust::Draw()
 
 void Dust::Create(void *data)
 {
+    Player::BumpChildGeneration(this);
+
     this->animator.SetAnimation(sVars->aniFrames, 0, true, 0);
 
     if (!sceneInfo->inEditor) {
@@ -39,43 +39,29 @@ void ImageTrail::LateUpdate()
             }
     }
 
-    // Update recordings
-    for (int32 i = IMAGETRAIL_TRACK_COUNT - 1; i > 0; --i) {
-        this->statePos[i].x     = this->statePos[i - 1].x;
-        this->statePos[i].y     = this->statePos[i - 1].y;
-        this->stateRotation[i]  = this->stateRotation[i - 1];
-        this->stateScale[i]     = this->stateScale[i - 1];
-        this->stateDirection[i] = this->stateDirection[i - 1];
-        this->stateVisible[i]   = this->stateVisible[i - 1];
-        memcpy(&this->stateAnimator[i], &this->stateAnimator[i - 1], sizeof(Animator));
-    }
-
-    this->statePos[0].x     = this->currentPos.x;
-    this->statePos[0].y     = this->currentPos.y;
-    this->stateRotation[0]  = this->currentRotation;
-    this->stateDirection[0] = this->currentDirection;
-    this->stateScale[0]     = this->currentScale;
-    this->stateVisible[0]   = this->currentVisible;
-    memcpy(&this->stateAnimator[0], &this->currentAnimator, sizeof(Animator));
-
-    // Record Player
-    this->drawGroup        = player->drawGroup - 1;
-    this->currentPos.x     = player->position.x;
-    this->currentPos.y     = player->position.y;
-    this->currentRotation  = player->rotation;
-    this->currentDirection = player->direction;
-    memcpy(&this->currentAnimator, &player->animator, sizeof(Animator));
+    // Record Player, this overwrites the oldest entry in the history
+    this->historyHead     = (this->historyHead + 1) & (IMAGETRAIL_HISTORY_COUNT - 1);
+    TrailRecord *record   = &this->history[this->historyHead];
+    this->drawGroup       = player->drawGroup - 1;
+    record->position.x    = player->position.x;
+    record->position.y    = player->position.y;
+    record->rotation      = player->rotation;
+    record->direction     = player->direction;
+    record->frames        = player->animator.frames;
+    record->frameID       = player->animator.frameID;
+    record->frameCount    = player->animator.frameCount;
+    record->rotationStyle = player->animator.rotationStyle;
 
     if (player->isChibi || !(player->drawFX & FX_SCALE))
-        this->currentScale = 0x200;
+        record->scale = 0x200;
     else
-        this->currentScale = player->scale.x;
+        record->scale = player->scale.x;
 
     // Check if we have enough speed to be visible
     if (abs(player->velocity.x) >= 0x10000 || abs(player->velocity.y) >= 0x10000)
-        this->currentVisible = player->visible;
+        record->visible = player->visible;
     else
-        this->currentVisible = false;
+        record->visible = false;
 }
 void ImageTrail::StaticUpdate() {}
 void ImageTrail::Draw()
@@ -94,25 +80,39 @@ void ImageTrail::Draw()
         case ID_KNUCKLES: player->HandleSuperColors_Knux(true); break;
     }
 
-    for (int32 i = (IMAGETRAIL_TRACK_COUNT / 3); i >= 0; --i) {
-        int32 id = (i * 3) - (i - 1);
-
-        Vector2 posStore = this->position;
-        if (this->stateVisible[id]) {
-            if (this->stateScale[id] != 0x200) {
-                this->drawFX |= FX_SCALE;
-                this->scale.x = this->stateScale[id];
-                this->scale.y = this->stateScale[id];
+    bool32 hasVisibleRecords = false;
+    for (int32 i = (IMAGETRAIL_TRACK_COUNT / 3); i >= 0; --i) hasVisibleRecords |= this->GetRecord((i * 3) - (i - 1) + 1)->visible;
+
+    // with nothing visible only the sprite walk is skipped, the super colors & the palette restore below still happen
+    if (hasVisibleRecords) {
+        Animator drawAnimator;
+        memset(&drawAnimator, 0, sizeof(drawAnimator));
+        for (int32 i = (IMAGETRAIL_TRACK_COUNT / 3); i >= 0; --i) {
+            // walk back from the head, skipping the record taken this frame
+            TrailRecord *record = this->GetRecord((i * 3) - (i - 1) + 1);
+
+            Vector2 posStore = this->position;
+            if (record->visible) {
+                if (record->scale != 0x200) {
+                    this->drawFX |= FX_SCALE;
+                    this->scale.x = record->scale;
+                    this->scale.y = record->scale;
+                }
+                this->alpha = alpha;
+                alpha += inc;
+                this->rotation  = record->rotation;
+                this->direction = record->direction;
+                this->position  = record->position;
+
+                drawAnimator.frames        = record->frames;
+                drawAnimator.frameID       = record->frameID;
+                drawAnimator.frameCount    = record->frameCount;
+                drawAnimator.rotationStyle = record->rotationStyle;
+                player->DrawSprite((Player *)this, &drawAnimator);
+                this->drawFX &= ~FX_SCALE;
             }
-            this->alpha = alpha;
-            alpha += inc;
-            this->rotation  = this->stateRotation[id];
-            this->direction = this->stateDirection[id];
-            this->position  = this->statePos[id];
-            player->DrawSprite((Player*)this, &this->stateAnimator[id]);
-            this->drawFX &= ~FX_SCALE;
+            this->position = posStore;
         }
-        this->position = posStore;
     }
 
     if (this->playerClassID == player->classID) {
@@ -133,12 +133,14 @@ void ImageTrail::Create(void *data)
         this->drawFX        = FX_FLIP | FX_SCALE | FX_ROTATE;
         this->inkEffect     = INK_ALPHA;
 
-        for (int32 i = IMAGETRAIL_TRACK_COUNT - 1; i >= 0; --i) {
-            this->statePos[i].x     = player->position.x;
-            this->statePos[i].y     = player->position.y;
-            this->stateRotation[i]  = player->rotation;
-            this->stateDirection[i] = player->direction;
-            this->stateVisible[i]   = false;
+        this->historyHead = 0;
+        for (int32 i = IMAGETRAIL_HISTORY_COUNT - 1; i >= 0; --i) {
+            TrailRecord *record = &this->history[i];
+            record->position.x  = player->position.x;
+            record->position.y  = player->position.y;
+            record->rotation    = player->rotation;
+            record->direction   = player->direction;
+            record->visible     = false;
         }
         this->lastPos = player->position;
     }
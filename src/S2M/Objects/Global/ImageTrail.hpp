@@ -7,7 +7,8 @@ namespace GameLogic
 {
 
 // Constants
-#define IMAGETRAIL_TRACK_COUNT (7)
+#define IMAGETRAIL_TRACK_COUNT   (7)
+#define IMAGETRAIL_HISTORY_COUNT (8) // current record + IMAGETRAIL_TRACK_COUNT, must be a power of 2
 
 struct ImageTrail : RSDK::GameObject::Entity {
 
@@ -19,6 +20,19 @@ struct ImageTrail : RSDK::GameObject::Entity {
     // STRUCTS
     // ==============================
 
+    // only what Player::DrawSprite needs from the animator, rather than a full copy of it
+    struct TrailRecord {
+        RSDK::SpriteFrame *frames;
+        int32 frameID;
+        int32 frameCount;
+        uint8 rotationStyle;
+        uint8 direction;
+        uint8 visible;
+        int32 rotation;
+        int32 scale;
+        RSDK::Vector2 position;
+    };
+
     // ==============================
     // STATIC VARS
     // ==============================
@@ -31,18 +45,8 @@ struct ImageTrail : RSDK::GameObject::Entity {
     // ==============================
     Player *player;
     int32 playerClassID;
-    RSDK::Vector2 currentPos;
-    RSDK::Vector2 statePos[IMAGETRAIL_TRACK_COUNT];
-    int32 currentRotation;
-    int32 stateRotation[IMAGETRAIL_TRACK_COUNT];
-    uint8 currentDirection;
-    uint8 stateDirection[IMAGETRAIL_TRACK_COUNT];
-    uint8 currentVisible;
-    uint8 stateVisible[IMAGETRAIL_TRACK_COUNT];
-    int32 currentScale;
-    int32 stateScale[IMAGETRAIL_TRACK_COUNT];
-    RSDK::Animator currentAnimator;
-    RSDK::Animator stateAnimator[IMAGETRAIL_TRACK_COUNT];
+    TrailRecord history[IMAGETRAIL_HISTORY_COUNT];
+    int32 historyHead;
     int32 baseAlpha;
     int32 fadeoutTimer;
     RSDK::Vector2 lastPos;
@@ -72,6 +76,9 @@ struct ImageTrail : RSDK::GameObject::Entity {
     // FUNCTIONS
     // ==============================
 
+    // 0 = the latest recording, 1 = the oldest state drawn from, etc
+    inline TrailRecord *GetRecord(int32 age) { return &this->history[(this->historyHead - age) & (IMAGETRAIL_HISTORY_COUNT - 1)]; }
+
     // ==============================
     // DECLARATION
     // ==============================
@@ -8,6 +8,7 @@
 #include "Zone.hpp"
 #include "DebugMode.hpp"
 #include "Music.hpp"
+#include "SaveGame.hpp"
 #include "Shield.hpp"
 #include "ImageTrail.hpp"
 #include "InvincibleStars.hpp"
@@ -240,6 +241,7 @@ void ItemBox::State_IconFinish()
     if (this->contentsAnimator.frameID == this->contentsAnimator.frameCount - 1) {
         this->contentsAnimator.SetAnimation(nullptr, 0, true, 0);
         this->state.Set(&ItemBox::State_Done);
+        SaveGame::RecordBrokenItemBox(this->Slot());
     }
 }
 
@@ -418,13 +420,13 @@ void ItemBox::GivePowerup()
             if (player->superState == Player::SuperStateNone) {
                 InvincibleStars *invincibleStars = GameObject::Get<InvincibleStars>(Player::sVars->maxPlayerCount + player->Slot());
                 invincibleStars->Reset(InvincibleStars::sVars->classID, player);
-                player->invincibleTimer = 1260;
+                player->SetInvincibleTimer(1260);
                 Music::PlayJingle(Music::TRACK_INVINCIBLE);
             }
             break;
 
         case ItemBox::Sneaker:
-            player->speedShoesTimer = 1320;
+            player->SetSpeedShoesTimer(1320);
             player->UpdatePhysicsState();
 
             if (player->superState == Player::SuperStateNone) {
@@ -33,7 +33,7 @@ void Localization::LoadStrings()
     switch (sVars->language) {
         case LANGUAGE_EN:
         default:
-            LogHelpers::Print("Loading EN strings...");
+            LOG_PRINT("Loading EN strings...");
             sVars->text.LoadStrings("StringsEN.txt");
             break;
     }
@@ -73,6 +73,9 @@ void Music::StageLoad()
     sVars->musicSpeedUp.Set(nullptr);
     sVars->musicSlowDown.Set(nullptr);
     sVars->isSpedUp = false;
+
+    sVars->stackCount = 0;
+    sVars->stackMask  = 0;
 }
 
 void Music::SetMusicTrack(uint8 track, const char *path, uint32 loopPoint)
@@ -133,22 +136,18 @@ void Music::PlayJingle(uint8 trackID)
     trackID &= 0xF;
 
     // remove any existing vers of this on the stack
-    for (int32 slot = SLOT_MUSICSTACK_START; slot < SLOT_MUSICSTACK_END; ++slot) {
-        Music *music = GameObject::Get<Music>(slot);
-        if (music->classID == sVars->classID && music->trackID == trackID) {
-            music->Destroy();
-        }
+    for (Music *existing = GetMusicStackTrack(trackID); existing; existing = GetMusicStackTrack(trackID)) {
+        RemoveMusicStack(existing);
+        existing->Destroy();
     }
 
-    Music *entity = nullptr;
-    // get the first empty stack slot
-    for (int32 slot = SLOT_MUSICSTACK_START; slot < SLOT_MUSICSTACK_END; ++slot) {
-        entity = GameObject::Get<Music>(slot);
-        if (entity->classID != sVars->classID) {
-            entity->Reset(sVars->classID, nullptr);
-            break;
-        }
-    }
+    // get the first empty stack slot, or reuse the last one if they're all taken
+    int32 stackID = 0;
+    while (stackID < MUSIC_STACK_COUNT - 1 && (sVars->stackMask & (1 << stackID))) ++stackID;
+
+    Music *entity = GameObject::Get<Music>(SLOT_MUSICSTACK_START + stackID);
+    if (!(sVars->stackMask & (1 << stackID)))
+        entity->Reset(sVars->classID, nullptr);
 
     entity->trackID = trackID;
     entity->state.Set(&Music::State_Jingle);
@@ -182,16 +181,13 @@ void Music::PlayJingle(uint8 trackID)
         default: break;
     }
 
+    PushMusicStack(entity);
     entity->GetNextTrackStartPos();
 
-    for (int32 slot = SLOT_MUSICSTACK_START; slot < SLOT_MUSICSTACK_END; ++slot) {
-        Music *music = GameObject::Get<Music>(slot);
-        if (music->classID == sVars->classID && music != entity) {
-            if (music->trackPriority > entity->trackPriority) {
-                entity->volume = 0.0;
-                return;
-            }
-        }
+    Music *top = GetMusicStackTop();
+    if (top != entity && top->trackPriority > entity->trackPriority) {
+        entity->volume = 0.0;
+        return;
     }
 
     Stop();
@@ -249,22 +245,18 @@ void Music::PlayAutoMusicQueuedTrack(uint8 trackID)
     sVars->nextTrack = TRACK_STAGE;
 
     // remove any existing vers of this on the stack
-    for (int32 slot = SLOT_MUSICSTACK_START; slot < SLOT_MUSICSTACK_END; ++slot) {
-        Music *music = GameObject::Get<Music>(slot);
-        if (music->classID == sVars->classID && music->trackID == trackID) {
-            music->Destroy();
-        }
+    for (Music *existing = GetMusicStackTrack(trackID); existing; existing = GetMusicStackTrack(trackID)) {
+        RemoveMusicStack(existing);
+        existing->Destroy();
     }
 
-    Music *entity = nullptr;
-    // get the first empty stack slot
-    for (int32 slot = SLOT_MUSICSTACK_START; slot < SLOT_MUSICSTACK_END; ++slot) {
-        entity = GameObject::Get<Music>(slot);
-        if (entity->classID != sVars->classID) {
-            entity->Destroy();
-            break;
-        }
-    }
+    // get the first empty stack slot, or reuse the last one if they're all taken
+    int32 stackID = 0;
+    while (stackID < MUSIC_STACK_COUNT - 1 && (sVars->stackMask & (1 << stackID))) ++stackID;
+
+    Music *entity = GameObject::Get<Music>(SLOT_MUSICSTACK_START + stackID);
+    if (!(sVars->stackMask & (1 << stackID)))
+        entity->Destroy();
 
     entity->trackID = trackID;
     entity->state.Set(&Music::State_Jingle);
@@ -298,28 +290,31 @@ void Music::PlayAutoMusicQueuedTrack(uint8 trackID)
 
         default: break;
     }
+
+    PushMusicStack(entity);
 }
 
 void Music::HandleMusicStack_Powerups()
 {
-    for (int32 slot = SLOT_MUSICSTACK_START; slot < SLOT_MUSICSTACK_END; ++slot) {
-        Music *music = GameObject::Get<Music>(slot);
-        if (music->classID == sVars->classID && music->trackPriority == PriorityPowerup && music->trackID != this->trackID && music != this)
-            music->trackPriority = PriorityAny;
+    Music *demoted[MUSIC_STACK_COUNT];
+    int32 demotedCount = 0;
+
+    for (int32 s = 0; s < sVars->stackCount; ++s) {
+        Music *music = GameObject::Get<Music>(SLOT_MUSICSTACK_START + sVars->stackOrder[s]);
+        if (music->trackPriority == PriorityPowerup && music->trackID != this->trackID && music != this)
+            demoted[demotedCount++] = music;
+    }
+
+    for (int32 d = 0; d < demotedCount; ++d) {
+        demoted[d]->trackPriority = PriorityAny;
+        PushMusicStack(demoted[d]);
     }
 }
 
 bool32 Music::CheckMusicStack_Active()
 {
-    bool32 active = false;
-
-    for (int32 slot = SLOT_MUSICSTACK_START; slot < SLOT_MUSICSTACK_END; ++slot) {
-        Music *music = GameObject::Get<Music>(slot);
-        if (music->classID == sVars->classID && music->trackPriority > PriorityNone)
-            active = true;
-    }
-
-    return active;
+    Music *top = GetMusicStackTop();
+    return top && top->trackPriority > PriorityNone;
 }
 
 bool32 Music::IsPlaying() { return channels[Music::sVars->channelID].IsActive(); }
@@ -328,8 +323,8 @@ void Music::GetNextTrackStartPos()
 {
     int32 stackCount = 0;
 
-    for (int32 slot = SLOT_MUSICSTACK_START; slot < SLOT_MUSICSTACK_END; ++slot) {
-        Music *music = GameObject::Get<Music>(slot);
+    for (int32 s = 0; s < sVars->stackCount; ++s) {
+        Music *music = GameObject::Get<Music>(SLOT_MUSICSTACK_START + sVars->stackOrder[s]);
         if (music->classID == sVars->classID && this != music) {
             if (music->trackID == sVars->activeTrack) {
                 this->trackStartPos = channels[sVars->channelID].AudioPos();
@@ -353,16 +348,14 @@ void Music::JingleFadeOut(uint8 trackID, bool32 transitionFade)
 {
     trackID &= 0xF;
 
-    for (int32 slot = SLOT_MUSICSTACK_START; slot < SLOT_MUSICSTACK_END; ++slot) {
-        Music *music = GameObject::Get<Music>(slot);
-        if (music->classID == sVars->classID && music->trackID == trackID) {
-            if (transitionFade) {
-                music->state.Set(&Music::State_JingleFade);
-                music->fadeSpeed = 0.05f;
-            }
-            else {
-                music->timer = 1;
-            }
+    Music *music = GetMusicStackTrack(trackID);
+    if (music) {
+        if (transitionFade) {
+            music->state.Set(&Music::State_JingleFade);
+            music->fadeSpeed = 0.05f;
+        }
+        else {
+            music->timer = 1;
         }
     }
 }
@@ -374,27 +367,21 @@ void Music::FinishJingle()
         music->Destroy();
 
         // remove all of these buggers that have higher priority and thus wont be played
-        for (int32 slot = SLOT_MUSICSTACK_START; slot < SLOT_MUSICSTACK_END; ++slot) {
-            Music *stack = GameObject::Get<Music>(slot);
-            if (stack->classID == sVars->classID && stack->trackPriority > this->trackPriority) {
-                this->Destroy();
-                return;
-            }
+        Music *top = GetMusicStackTop();
+        if (top && top->trackPriority > this->trackPriority) {
+            RemoveMusicStack(this);
+            this->Destroy();
+            return;
         }
 
         bool32 restartTrack = this->restartTrack;
+        RemoveMusicStack(this);
         this->Destroy();
-        int32 priority = 0;
 
-        Music *trackPtr = nullptr;
         // the next track to be played will be the track with the highest priority on the stack (may be none)
-        for (int32 slot = SLOT_MUSICSTACK_START; slot < SLOT_MUSICSTACK_END; ++slot) {
-            Music *stack = GameObject::Get<Music>(slot);
-            if (stack->classID == sVars->classID && stack->trackPriority > priority) {
-                trackPtr = stack;
-                priority = stack->trackPriority;
-            }
-        }
+        Music *trackPtr = GetMusicStackTop();
+        if (trackPtr && trackPtr->trackPriority <= PriorityNone)
+            trackPtr = nullptr;
 
         Stop();
         if (trackPtr) { // another track is on the music stack still
@@ -439,6 +426,7 @@ void Music::FinishJingle()
         }
     }
     else {
+        RemoveMusicStack(this);
         this->Destroy();
     }
 }
@@ -446,6 +434,73 @@ void Music::FinishJingle()
 void Music::ClearMusicStack()
 {
     for (int32 slot = SLOT_MUSICSTACK_START; slot < SLOT_MUSICSTACK_END; ++slot) GameObject::Get<Music>(slot)->Destroy();
+
+    sVars->stackCount = 0;
+    sVars->stackMask  = 0;
+}
+
+void Music::PushMusicStack(Music *music)
+{
+    RemoveMusicStack(music);
+    if (music->classID != sVars->classID)
+        return;
+
+    // keep the stack ordered by priority, then by slot, so the top is the same entry the old scans over every stack slot would've picked
+    uint8 stackID = (uint8)(music->Slot() - SLOT_MUSICSTACK_START);
+    int32 pos     = sVars->stackCount++;
+    for (; pos > 0; --pos) {
+        uint8 prevID = sVars->stackOrder[pos - 1];
+        Music *prev  = GameObject::Get<Music>(SLOT_MUSICSTACK_START + prevID);
+        if (prev->trackPriority > music->trackPriority || (prev->trackPriority == music->trackPriority && prevID < stackID))
+            break;
+
+        sVars->stackOrder[pos] = prevID;
+    }
+
+    sVars->stackOrder[pos] = stackID;
+    sVars->stackMask |= 1 << stackID;
+}
+
+void Music::RemoveMusicStack(Music *music)
+{
+    int32 stackID = music->Slot() - SLOT_MUSICSTACK_START;
+    if (stackID < 0 || stackID >= MUSIC_STACK_COUNT || !(sVars->stackMask & (1 << stackID)))
+        return;
+
+    for (int32 s = 0; s < sVars->stackCount; ++s) {
+        if (sVars->stackOrder[s] == stackID) {
+            memmove(&sVars->stackOrder[s], &sVars->stackOrder[s + 1], sVars->stackCount - s - 1);
+            sVars->stackCount--;
+            break;
+        }
+    }
+
+    sVars->stackMask &= ~(1 << stackID);
+}
+
+Music *Music::GetMusicStackTop()
+{
+    while (sVars->stackCount) {
+        Music *music = GameObject::Get<Music>(SLOT_MUSICSTACK_START + sVars->stackOrder[0]);
+        if (music->classID == sVars->classID)
+            return music;
+
+        // something else took over the slot, drop it
+        RemoveMusicStack(music);
+    }
+
+    return nullptr;
+}
+
+Music *Music::GetMusicStackTrack(uint8 trackID)
+{
+    for (int32 s = 0; s < sVars->stackCount; ++s) {
+        Music *music = GameObject::Get<Music>(SLOT_MUSICSTACK_START + sVars->stackOrder[s]);
+        if (music->classID == sVars->classID && music->trackID == trackID)
+            return music;
+    }
+
+    return nullptr;
 }
 
 void Music::PlayOnFade(uint8 trackID, float fadeSpeed)
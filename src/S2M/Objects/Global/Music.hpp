@@ -1,6 +1,8 @@
 #pragma once
 #include "S2M.hpp"
 
+#define MUSIC_STACK_COUNT (SLOT_MUSICSTACK_END - SLOT_MUSICSTACK_START)
+
 namespace GameLogic
 {
 
@@ -62,6 +64,9 @@ struct Music : RSDK::GameObject::Entity {
         RSDK::StateMachine<Music> musicSlowDown;
         bool32 isSpedUp;
         int32 field_2AC;
+        uint8 stackOrder[MUSIC_STACK_COUNT]; // stack slot offsets, highest priority first
+        int32 stackCount;
+        uint8 stackMask;
     };
 
     // ==============================
@@ -126,6 +131,11 @@ struct Music : RSDK::GameObject::Entity {
     void FinishJingle();
     static void ClearMusicStack();
 
+    static void PushMusicStack(Music *music);
+    static void RemoveMusicStack(Music *music);
+    static Music *GetMusicStackTop();
+    static Music *GetMusicStackTrack(uint8 trackID);
+
     static void PlayOnFade(uint8 trackID, float fadeSpeed);
     static void FadeOut(float fadeSpeed);
 
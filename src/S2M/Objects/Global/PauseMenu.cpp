@@ -27,6 +27,10 @@ namespace GameLogic
 {
 RSDK_REGISTER_OBJECT(PauseMenu);
 
+// the tint table never changes, so it's only ever built the once
+static uint16 tintLookupTable[0x10000];
+static bool32 tintTableReady = false;
+
 void PauseMenu::Update()
 {
     this->state.Run(this);
@@ -233,16 +237,26 @@ void PauseMenu::SetupMenu()
 
 void PauseMenu::SetupTintTable()
 {
+    if (tintTableReady)
+        return;
+
     // sets the tint color table, tho im gonna be honest i have no idea what its actually doing with all of these operators and hex numbers
+    // the result only depends on r + g + b (at most 255 + 256 + 255), so each possible sum only needs the one divide
+    uint16 tintForSum[767];
+    for (int32 sum = 0; sum < 767; ++sum) {
+        int32 brightness = MIN((sum << 8) / 680, 0xFF);
+        tintForSum[sum]  = (brightness >> 3) | ((brightness >> 2) << 5) | ((brightness >> 6) << 14);
+    }
+
     for (int32 i = 0; i < 0x10000; ++i) {
         uint32 r = (0x20F * (i >> 11) + 23) >> 6;
         uint32 g = (0x103 * ((i >> 5) & 0x3F) + 33) >> 6;
         uint32 b = (0x20F * (i & 0x1F) + 23) >> 6;
 
-        int32 brightness = MIN(((b + g + r) << 8) / 680, 0xFF);
-
-        sVars->tintLookupTable[i] = (brightness >> 3) | ((brightness >> 2) << 5) | ((brightness >> 6) << 14);
+        tintLookupTable[i] = tintForSum[b + g + r];
     }
+
+    tintTableReady = true;
 }
 
 void PauseMenu::AddButton(uint8 id, Action<void> action)
@@ -347,7 +361,7 @@ void PauseMenu::FocusCamera()
     if (!Camera::sVars)
         return;
 
-    LogHelpers::Print("FocusCamera(): triggerPlayer = %d", this->triggerPlayer);
+    LOG_PRINT("FocusCamera(): triggerPlayer = %d", this->triggerPlayer);
     for (auto cameraPtr : GameObject::GetEntities<Camera>(FOR_ALL_ENTITIES)) {
         int32 id         = RSDKTable->GetEntitySlot(cameraPtr);
         int32 prevScreen = cameraPtr->screenID;
@@ -358,7 +372,7 @@ void PauseMenu::FocusCamera()
         else {
             cameraPtr->screenID = 1;
         }
-        LogHelpers::Print("cameraPtr->screenID %d => %d", prevScreen, cameraPtr->screenID);
+        LOG_PRINT("cameraPtr->screenID %d => %d", prevScreen, cameraPtr->screenID);
     }
 }
 
@@ -1047,7 +1061,7 @@ void PauseMenu::Draw_RegularPause()
 {
     // actually draws the bg tint and sets it up with the lookup table
     if (!this->state.Matches(&PauseMenu::State_HandleFadeout)) {
-        RSDKTable->SetTintLookupTable(sVars->tintLookupTable);
+        RSDKTable->SetTintLookupTable(tintLookupTable);
         Graphics::DrawRect(0, 0, screenInfo->size.x, screenInfo->size.y, 0, this->tintAlpha, INK_TINT, true);
 
         // calls the start draw function whenever first paused, and after 32 frames it will be set to the idle function if the current state isnt
@@ -1074,7 +1088,7 @@ void PauseMenu::Draw_ForcePause()
     // actually draws the bg tint and sets it up with the lookup table
     // ONLY draws the bg tint with none of the other pause menu stuff, as a forced pause's only purpose is to have the controller be reconnected
     if (!this->state.Matches(&PauseMenu::State_HandleFadeout)) {
-        RSDKTable->SetTintLookupTable(sVars->tintLookupTable);
+        RSDKTable->SetTintLookupTable(tintLookupTable);
         Graphics::DrawRect(0, 0, screenInfo->size.x, screenInfo->size.y, 0, this->tintAlpha, INK_TINT, true);
     }
 }
@@ -29,7 +29,6 @@ struct PauseMenu : RSDK::GameObject::Entity {
         bool32 forcedDisconnect;
         bool32 signOutDetected;
         bool32 activeChannels[0x10];
-        uint16 tintLookupTable[0x10000];
     };
 
     // ==============================
@@ -9,6 +9,7 @@
 #include "Zone.hpp"
 #include "DebugMode.hpp"
 #include "Common/ScreenWrap.hpp"
+#include "Helpers/SolidIndex.hpp"
 
 using namespace RSDK;
 
@@ -50,6 +51,9 @@ void PlaneSwitch::Create(void *data)
         if (ScreenWrap::CheckCompetitionWrap())
             this->active = ACTIVE_NORMAL;
     }
+
+    if (!sceneInfo->inEditor)
+        SolidIndex::Register(this, SolidIndex::SolidPlaneSwitch);
 }
 
 void PlaneSwitch::StageLoad() { sVars->aniFrames.Load("Global/PlaneSwitch.bin", SCOPE_STAGE); }
@@ -36,6 +36,7 @@
 #include "Helpers/BadnikHelpers.hpp"
 #include "Helpers/DrawHelpers.hpp"
 #include "Helpers/LogHelpers.hpp"
+#include "Helpers/StateProfiler.hpp"
 
 using namespace RSDK;
 
@@ -49,14 +50,16 @@ bool32 inDeathHold = false;
 
 void Player::Update()
 {
+    S2M_PROFILE_EVENT();
+
     if (!this->state.Matches(&Player::State_Static))
         this->direction = (this->direction & ~FLIP_Y) | (FLIP_Y * (globals->gravityDir == CMODE_ROOF));
 
     if (!this->playerID)
         sVars->finishedInput = false;
 
-    this->stateInputReplay.Run(this);
-    this->stateInput.Run(this);
+    S2M_PROFILE_STATE(this->stateInputReplay, this);
+    S2M_PROFILE_STATE(this->stateInput, this);
 
     if (this->sidekick)
         this->HandleSidekickRespawn();
@@ -92,36 +95,22 @@ void Player::Update()
                 this->invincibleTimer++;
             }
             else {
-                this->invincibleTimer--;
+                SetInvincibleTimer(this->invincibleTimer - 1);
                 if (!this->invincibleTimer) {
                     ApplyShield();
 
-                    if (!this->sidekick) {
-                        bool32 stopPlaying = true;
-                        for (auto player : GameObject::GetEntities<Player>(FOR_ACTIVE_ENTITIES)) {
-                            if (player->invincibleTimer > 0)
-                                stopPlaying = false;
-                        }
-
-                        if (stopPlaying)
-                            Music::JingleFadeOut(Music::TRACK_INVINCIBLE, true);
-                    }
+                    if (!this->sidekick && !sVars->invincibleCount)
+                        Music::JingleFadeOut(Music::TRACK_INVINCIBLE, true);
                 }
             }
         }
 
         if (this->speedShoesTimer > 0) {
-            this->speedShoesTimer--;
+            SetSpeedShoesTimer(this->speedShoesTimer - 1);
             if (!this->speedShoesTimer) {
                 UpdatePhysicsState();
 
-                bool32 stopPlaying = true;
-                for (auto player : GameObject::GetEntities<Player>(FOR_ACTIVE_ENTITIES)) {
-                    if (player->speedShoesTimer > 0)
-                        stopPlaying = false;
-                }
-
-                if (stopPlaying) {
+                if (!sVars->speedShoesCount) {
                     if (globals->ostStyle == GAME_SM)
                         Music::JingleFadeOut(Music::TRACK_SNEAKERS, true);
                     else
@@ -179,7 +168,7 @@ void Player::Update()
         }
 
         if (!this->state.Matches(&Player::State_FlyToPlayer))
-            this->state.Run(this);
+            S2M_PROFILE_STATE(this->state, this);
 
         if (this->disableGravity)
             return;
@@ -210,8 +199,10 @@ void Player::Update()
 }
 void Player::LateUpdate()
 {
+    S2M_PROFILE_EVENT();
+
     if (this->state.Matches(&Player::State_FlyToPlayer))
-        this->state.Run(this);
+        S2M_PROFILE_STATE(this->state, this);
 
     if (this->state.Matches(&Player::State_Hurt)) {
         int32 bounds = Zone::sVars->playerBoundsT[this->playerID] + 0x100000;
@@ -235,13 +226,13 @@ void Player::LateUpdate()
 
         if (this->sidekick) {
             if (this->invincibleTimer > 1)
-                this->invincibleTimer = 1;
+                SetInvincibleTimer(1);
             if (this->speedShoesTimer > 1)
-                this->speedShoesTimer = 1;
+                SetSpeedShoesTimer(1);
         }
         else {
-            this->invincibleTimer = 0;
-            this->speedShoesTimer = 0;
+            SetInvincibleTimer(0);
+            SetSpeedShoesTimer(0);
         }
 
         if (this->gravityStrength <= 1)
@@ -325,10 +316,10 @@ void Player::LateUpdate()
 
     if (this->onGround) {
         if (!this->nextGroundState.Matches(nullptr)) {
-            Shield *shield = GameObject::Get<Shield>(sVars->maxPlayerCount + this->playerID);
-            if (shield->classID == Shield::sVars->classID && shield->state.Matches(&Shield::State_Insta)) {
+            Shield *shield = (Shield *)GetChild(&this->shieldChild);
+            if (shield && shield->state.Matches(&Shield::State_Insta)) {
                 shield->shieldAnimator.SetAnimation(Shield::sVars->aniFrames, Shield::AniInsta, true, shield->shieldAnimator.frameCount - 1);
-                this->invincibleTimer = 0;
+                SetInvincibleTimer(0);
             }
 
             this->state = this->nextGroundState;
@@ -363,7 +354,7 @@ void Player::LateUpdate()
     if (this->disableGravity)
         this->disableGravity = false;
     else
-        this->stateGravity.Run(this);
+        S2M_PROFILE_STATE(this->stateGravity, this);
 
     int32 state = this->hyperAbilityState - 2;
     switch (state) {
@@ -454,6 +445,10 @@ void Player::LateUpdate()
 }
 void Player::StaticUpdate()
 {
+    S2M_PROFILE_STATIC_EVENT();
+
+    CountPowerUps();
+
     if (sVars->superDashCooldown > 0) {
         GameObject::Get<Player>(SLOT_PLAYER1);
         HUD::EnableRingFlash();
@@ -504,6 +499,8 @@ void Player::StaticUpdate()
 }
 void Player::Draw()
 {
+    S2M_PROFILE_EVENT();
+
     color paletteStorage[2][32];
     for (int32 i = 0LL; i < 32; ++i) {
         paletteStorage[1][i] = paletteBank[0].GetEntry(i);
@@ -738,6 +735,9 @@ void Player::Create(void *data)
 
 void Player::StageLoad()
 {
+    sVars->invincibleCount = 0;
+    sVars->speedShoesCount = 0;
+
     if (!globals->playerID)
         globals->playerID = ID_DEFAULT_PLAYER;
 
@@ -1266,6 +1266,7 @@ void Player::ApplyShield()
             int32 animID   = shield->shieldAnimator.animationID;
             int32 type     = shield->type;
             shield->Reset(Shield::sVars->classID, player);
+            LinkChild(&player->shieldChild, shield);
             if (type == player->shield)
                 shield->shieldAnimator.SetAnimation(Shield::sVars->aniFrames, animID, true, frameID);
         }
@@ -1474,7 +1475,7 @@ bool32 Player::TryTransform(bool32 fastTransform, TransformModes transformMode)
         else
             this->animator.SetAnimation(this->aniFrames, ANI_TRANSFORM, false, 0);
 
-        this->invincibleTimer  = 60;
+        SetInvincibleTimer(60);
         this->abilityValues[6] = this->velocity.x;
         this->abilityValues[7] = this->velocity.y;
         this->velocity.x       = 0;
@@ -1526,6 +1527,53 @@ bool32 Player::TryTransform(bool32 fastTransform, TransformModes transformMode)
     return true;
 }
 
+void Player::BumpChildGeneration(RSDK::GameObject::Entity *child)
+{
+    if (sVars)
+        sVars->childGenerations[child->Slot()]++;
+}
+
+void Player::LinkChild(ChildHandle *handle, RSDK::GameObject::Entity *child)
+{
+    handle->slot       = child->Slot();
+    handle->classID    = child->classID;
+    handle->generation = sVars->childGenerations[handle->slot];
+}
+
+RSDK::GameObject::Entity *Player::GetChild(ChildHandle *handle)
+{
+    Entity *child = GameObject::Get(handle->slot);
+    if (!handle->classID || child->classID != handle->classID || sVars->childGenerations[handle->slot] != handle->generation)
+        return nullptr;
+
+    return child;
+}
+
+void Player::SetInvincibleTimer(int32 timer)
+{
+    sVars->invincibleCount += (timer > 0) - (this->invincibleTimer > 0);
+    this->invincibleTimer = timer;
+}
+
+void Player::SetSpeedShoesTimer(int32 timer)
+{
+    sVars->speedShoesCount += (timer > 0) - (this->speedShoesTimer > 0);
+    this->speedShoesTimer = timer;
+}
+
+void Player::CountPowerUps()
+{
+    // resync once a frame in case a player was created or destroyed mid-frame, the setters keep it exact from here on
+    sVars->invincibleCount = 0;
+    sVars->speedShoesCount = 0;
+    for (auto player : GameObject::GetEntities<Player>(FOR_ACTIVE_ENTITIES)) {
+        if (player->invincibleTimer > 0)
+            sVars->invincibleCount++;
+        if (player->speedShoesTimer > 0)
+            sVars->speedShoesCount++;
+    }
+}
+
 Player *Player::GetNearestPlayerX()
 {
     GameObject::Entity *self = (GameObject::Entity *)sceneInfo->entity;
@@ -2676,7 +2724,7 @@ void Player::HandleSuperForm()
         }
 
         if (!canStopSuper) {
-            this->invincibleTimer = 60;
+            SetInvincibleTimer(60);
             if (--this->superRingLossTimer <= 0) {
                 this->superRingLossTimer = 60;
                 if (--this->rings <= 0) {
@@ -2715,7 +2763,7 @@ void Player::HandleSuperForm()
             this->animator.SetAnimation(this->aniFrames, this->animator.animationID, true, this->animator.frameID);
         }
 
-        this->invincibleTimer = 0;
+        SetInvincibleTimer(0);
 
         if (this->shield)
             ApplyShield();
@@ -3080,6 +3128,7 @@ void Player::Action_Spindash()
     dust->animator.SetAnimation(Dust::sVars->aniFrames, 1, true, 0);
     dust->state.Set(&Dust::State_SpinDash);
     dust->drawGroup = this->drawGroup;
+    LinkChild(&this->spindashDust, dust);
 
     this->animator.SetAnimation(this->aniFrames, ANI_SPINDASH, true, 0);
     this->state.Set(&Player::State_Spindash);
@@ -3180,10 +3229,11 @@ void Player::Action_DblJumpSonic()
                     switch (this->shield) {
                         case Shield::None:
                             if (globals->medalMods & MEDAL_INSTASHIELD) {
-                                this->invincibleTimer  = -8;
+                                SetInvincibleTimer(-8);
                                 this->jumpAbilityState = 0;
                                 Shield::sVars->sfxInstaShield.Play();
                                 shield->Reset(Shield::sVars->classID, this);
+                                LinkChild(&this->shieldChild, shield);
                                 if (globals->useManiaBehavior) {
                                     shield->inkEffect = INK_ADD;
                                     shield->alpha     = 0x100;
@@ -3574,11 +3624,11 @@ void Player::State_Air()
             case ANI_JUMP:
                 if (globals->gravityDir == CMODE_ROOF) {
                     if (this->velocity.y <= -this->jumpCap)
-                        this->stateAbility.Run(this);
+                        S2M_PROFILE_STATE(this->stateAbility, this);
                 }
                 else if (globals->gravityDir == CMODE_FLOOR) {
                     if (this->velocity.y >= this->jumpCap)
-                        this->stateAbility.Run(this);
+                        S2M_PROFILE_STATE(this->stateAbility, this);
                 }
                 break;
 
@@ -3637,7 +3687,7 @@ void Player::State_LookUp()
 
         if (this->jumpPress) {
             if (!this->statePeelout.Matches(nullptr)) {
-                this->statePeelout.Run(this);
+                S2M_PROFILE_STATE(this->statePeelout, this);
             }
             else {
                 Action_Jump();
@@ -3755,18 +3805,15 @@ void Player::State_Spindash()
             this->state.Set(&Player::State_Ground);
         }
         else {
-
-            bool32 hasDust = false;
-            for (auto dust : GameObject::GetEntities<Dust>(FOR_ACTIVE_ENTITIES)) {
-                if (dust->state.Matches(&Dust::State_SpinDash) && dust->parent == this)
-                    hasDust = true;
-            }
+            Dust *spindashDust = (Dust *)GetChild(&this->spindashDust);
+            bool32 hasDust     = spindashDust && spindashDust->state.Matches(&Dust::State_SpinDash) && spindashDust->parent == this;
 
             if (!hasDust) {
                 Dust *dust = GameObject::Create<Dust>(this, this->position.x, this->position.y);
                 dust->animator.SetAnimation(Dust::sVars->aniFrames, 1, true, 0);
                 dust->state.Set(&Dust::State_SpinDash);
                 dust->drawGroup = this->drawGroup;
+                LinkChild(&this->spindashDust, dust);
 
                 this->groundVel = 0;
             }
@@ -5881,7 +5928,7 @@ void Player::State_Transform()
     SET_CURRENT_STATE();
 
     this->position.x += Zone::sVars->autoScrollSpeed;
-    this->invincibleTimer = 60;
+    SetInvincibleTimer(60);
     ++this->timer;
 
     if (this->animator.GetFrameID() == '0') {
@@ -5982,8 +6029,8 @@ void Player::State_StartSuper()
     this->superState = Player::SuperStateSuper;
 
     GameObject::Get(this->playerID + sVars->maxPlayerCount)->Destroy();
-    this->invincibleTimer = 60;
-    this->superState      = Player::SuperStateSuper;
+    SetInvincibleTimer(60);
+    this->superState = Player::SuperStateSuper;
     this->UpdatePhysicsState();
 
     this->state.SetAndRun(&Player::State_Ground, this);
@@ -7006,8 +7053,8 @@ bool32 Player::CheckBadnikTouch(RSDK::GameObject::Entity *entity, RSDK::Hitbox *
     Hitbox *playerHitbox = this->GetHitbox();
     Hitbox tempHitbox    = sVars->instaShieldHitbox;
 
-    Shield *shield = GameObject::Get<Shield>(sVars->maxPlayerCount + this->playerID);
-    if (shield->classID == Shield::sVars->classID && shield->state.Matches(&Shield::State_Insta)) {
+    Shield *shield = (Shield *)GetChild(&this->shieldChild);
+    if (shield && shield->state.Matches(&Shield::State_Insta)) {
 
         if (this->isChibi) {
             tempHitbox.left   = (playerHitbox->left << 1) - (playerHitbox->left >> 1);
@@ -7069,8 +7116,10 @@ bool32 Player::CheckBadnikTouch(RSDK::GameObject::Entity *entity, RSDK::Hitbox *
                             }
                         }
 
-                        for (auto flicky : GameObject::GetEntities<SuperFlicky>(FOR_ACTIVE_ENTITIES)) {
-                            if (flicky->state.Matches(&SuperFlicky::State_Active) && !flicky->attackDelay) {
+                        Player *flickyOwner = GameObject::Get<Player>(SuperFlicky::sVars->targetPlayerID);
+                        for (int32 f = 0; f < PLAYER_SUPERFLICKY_COUNT; ++f) {
+                            SuperFlicky *flicky = (SuperFlicky *)GetChild(&flickyOwner->superFlickies[f]);
+                            if (flicky && flicky->state.Matches(&SuperFlicky::State_Active) && !flicky->attackDelay) {
                                 if (flicky->attackListPos != -1) {
                                     if (Zone::sVars->flickyAttackList[flicky->attackListPos].isTargeted) {
                                         Entity *target = GameObject::Get(Zone::sVars->flickyAttackList[flicky->attackListPos].slotID);
@@ -7186,8 +7235,10 @@ bool32 Player::CheckBossHit(RSDK::GameObject::Entity *entity, bool32 enableHyper
                     return true;
 
                 if (Zone::sVars->hyperList[i].superFlickyTarget) {
-                    for (auto flicky : GameObject::GetEntities<SuperFlicky>(FOR_ACTIVE_ENTITIES)) {
-                        if (flicky->state.Matches(&SuperFlicky::State_Active) && !flicky->attackDelay) {
+                    Player *flickyOwner = GameObject::Get<Player>(SuperFlicky::sVars->targetPlayerID);
+                    for (int32 f = 0; f < PLAYER_SUPERFLICKY_COUNT; ++f) {
+                        SuperFlicky *flicky = (SuperFlicky *)GetChild(&flickyOwner->superFlickies[f]);
+                        if (flicky && flicky->state.Matches(&SuperFlicky::State_Active) && !flicky->attackDelay) {
                             if (flicky->attackListPos != -1) {
                                 if (Zone::sVars->flickyAttackList[flicky->attackListPos].isTargeted) {
                                     Entity *target = GameObject::Get(Zone::sVars->flickyAttackList[flicky->attackListPos].slotID);
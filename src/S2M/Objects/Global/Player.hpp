@@ -2,6 +2,8 @@
 #include "S2M.hpp"
 #include "Camera.hpp"
 
+#define PLAYER_SUPERFLICKY_COUNT (4)
+
 namespace GameLogic
 {
 
@@ -133,6 +135,13 @@ struct Player : RSDK::GameObject::Entity {
     // STRUCTS
     // ==============================
 
+    // slot + generation reference to an entity a player spawned, so a reused slot is never mistaken for it
+    struct ChildHandle {
+        uint16 slot;
+        uint16 classID;
+        uint32 generation;
+    };
+
     // ==============================
     // STATIC VARS
     // ==============================
@@ -233,6 +242,9 @@ struct Player : RSDK::GameObject::Entity {
         uint16 lookUpDistance;
         bool32 showHitbox;
         bool32 finishedInput;
+        uint32 childGenerations[ENTITY_COUNT];
+        int32 invincibleCount;
+        int32 speedShoesCount;
     };
 
     static RSDK::Hitbox fallbackHitbox;
@@ -345,6 +357,9 @@ struct Player : RSDK::GameObject::Entity {
     int32 hyperAbilityState;
     bool32 isHyper;
     bool32 disableTileCollisions;
+    ChildHandle spindashDust;
+    ChildHandle shieldChild;
+    ChildHandle superFlickies[PLAYER_SUPERFLICKY_COUNT];
 
     // ==============================
     // EVENTS
@@ -389,6 +404,14 @@ struct Player : RSDK::GameObject::Entity {
     void InvertGravity();
     bool32 TryTransform(bool32 fastTransform, TransformModes transformMode);
 
+    // Children
+    static void BumpChildGeneration(RSDK::GameObject::Entity *child);
+    static void LinkChild(ChildHandle *handle, RSDK::GameObject::Entity *child);
+    static RSDK::GameObject::Entity *GetChild(ChildHandle *handle);
+    void SetInvincibleTimer(int32 timer);
+    void SetSpeedShoesTimer(int32 timer);
+    static void CountPowerUps();
+
     static Player *GetNearestPlayerX();
     static Player *GetNearestPlayerXY();
 
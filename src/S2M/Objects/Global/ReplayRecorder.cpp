@@ -28,6 +28,9 @@ namespace GameLogic
 {
 RSDK_REGISTER_OBJECT(ReplayRecorder);
 
+// kept out here rather than in globals so the block isn't lost when GlobalVariables::Init clears them
+static uint8 *replayBufferBlock = nullptr;
+
 void ReplayRecorder::Update()
 {
     if (!this->paused) {
@@ -179,6 +182,14 @@ void ReplayRecorder::StageLoad()
         sVars->fileBuffer        = nullptr;
 
         memset(sVars->filename, 0, sizeof(sVars->filename));
+        if (!ReplayRecorder::AcquireBuffers()) {
+            // no replay buffers, so play the stage without recording or a ghost
+            sVars->active         = ACTIVE_NEVER;
+            sVars->recordBuffer   = nullptr;
+            sVars->playbackBuffer = nullptr;
+            return;
+        }
+
         sVars->recordBuffer    = (Replay *)globals->replayWriteBuffer;
         sVars->recordingFrames = sVars->recordBuffer->frames;
         sVars->playbackBuffer  = (Replay *)globals->replayReadBuffer;
@@ -220,9 +231,45 @@ void ReplayRecorder::StageLoad()
                 }
             }
 
-            LogHelpers::Print("CharID: %08x", globals->playerID);
+            LOG_PRINT("CharID: %08x", globals->playerID);
         }
     }
+    else if (Zone::sVars) {
+        // a regular stage, nothing will touch the replay buffers until we're back in time attack
+        ReplayRecorder::ReleaseBuffers();
+    }
+}
+
+bool32 ReplayRecorder::AcquireBuffers()
+{
+    if (!replayBufferBlock) {
+        // one block for all 4, zeroed like the old static buffers were
+        replayBufferBlock = (uint8 *)calloc(4, REPLAY_BUFFER_SIZE);
+        if (!replayBufferBlock) {
+            LOG_PRINT("ReplayRecorder::AcquireBuffers ERROR: failed to allocate replay buffers");
+            return false;
+        }
+    }
+
+    // always re-point these, GlobalVariables::Init clears them without knowing about the block
+    globals->replayWriteBuffer = (int32 *)(replayBufferBlock + 0 * REPLAY_BUFFER_SIZE);
+    globals->replayReadBuffer  = (int32 *)(replayBufferBlock + 1 * REPLAY_BUFFER_SIZE);
+    globals->replayTempWBuffer = (int32 *)(replayBufferBlock + 2 * REPLAY_BUFFER_SIZE);
+    globals->replayTempRBuffer = (int32 *)(replayBufferBlock + 3 * REPLAY_BUFFER_SIZE);
+    return true;
+}
+
+void ReplayRecorder::ReleaseBuffers()
+{
+    if (!replayBufferBlock)
+        return;
+
+    free(replayBufferBlock);
+    replayBufferBlock          = nullptr;
+    globals->replayWriteBuffer = nullptr;
+    globals->replayReadBuffer  = nullptr;
+    globals->replayTempWBuffer = nullptr;
+    globals->replayTempRBuffer = nullptr;
 }
 
 void ReplayRecorder::TitleCardCB(void)
@@ -241,7 +288,7 @@ void ReplayRecorder::TitleCardCB(void)
 
 void ReplayRecorder::Resume(ReplayRecorder *recorder)
 {
-    LogHelpers::Print("ReplayRecorder::Resume()");
+    LOG_PRINT("ReplayRecorder::Resume()");
     recorder->paused          = false;
     recorder->player->visible = true;
 }
@@ -281,10 +328,10 @@ void ReplayRecorder::Buffer_Move()
 
     if (replayPtr->header.isNotEmpty) {
         if (replayPtr->header.frameCount < sVars->recordingManager->maxFrameCount - 1) {
-            memset(globals->replayTempWBuffer, 0, sizeof(globals->replayTempWBuffer));
-            LogHelpers::Print("Buffer_Move(0x%08x, 0x%08x)", globals->replayTempWBuffer, replayPtr);
-            memcpy(globals->replayTempWBuffer, replayPtr, sizeof(globals->replayTempWBuffer));
-            memset(replayPtr, 0, sizeof(globals->replayWriteBuffer));
+            memset(globals->replayTempWBuffer, 0, REPLAY_BUFFER_SIZE);
+            LOG_PRINT("Buffer_Move(0x%08x, 0x%08x)", globals->replayTempWBuffer, replayPtr);
+            memcpy(globals->replayTempWBuffer, replayPtr, REPLAY_BUFFER_SIZE);
+            memset(replayPtr, 0, REPLAY_BUFFER_SIZE);
             ReplayRecorder::Buffer_PackInPlace(globals->replayTempWBuffer);
             HUD::sVars->replaySaveEnabled = true;
         }
@@ -307,12 +354,12 @@ void ReplayRecorder::SaveReplayDLG_YesCB()
     int32 mins      = sceneInfo->minutes;
     int32 secs      = sceneInfo->seconds;
     int32 millisecs = sceneInfo->milliseconds;
-    LogHelpers::Print("Bout to create ReplayDB entry...");
+    LOG_PRINT("Bout to create ReplayDB entry...");
 
     MenuParam *param = MenuParam::GetMenuParam();
     int32 rowID            = ReplayDB::AddReplay(param->zoneID, param->actID, param->characterID, millisecs + 100 * (secs + 60 * mins));
     if (rowID == -1) {
-        LogHelpers::Print("Table row ID invalid! %d", -1);
+        LOG_PRINT("Table row ID invalid! %d", -1);
         ReplayRecorder::SaveFile_Replay(false);
     }
     else {
@@ -321,7 +368,7 @@ void ReplayRecorder::SaveReplayDLG_YesCB()
 
         char fileName[0x20];
         sprintf_s(fileName, (int32)sizeof(fileName), "Replay_%08X.bin", sVars->replayID);
-        LogHelpers::Print("Replay Filename: %s", fileName);
+        LOG_PRINT("Replay Filename: %s", fileName);
         UILoadingIcon::StartWait();
 
         sVars->savedReplay = true;
@@ -350,7 +397,7 @@ void ReplayRecorder::SaveReplay()
     Replay *replayPtr = (Replay *)globals->replayTempWBuffer;
 
     if (replayPtr->header.isNotEmpty) {
-        LogHelpers::Print("Saving replay...");
+        LOG_PRINT("Saving replay...");
 
         for (int32 i = 0; i < SCENEENTITY_COUNT; ++i) {
             HUD *hud = GameObject::Get<HUD>(i);
@@ -367,7 +414,7 @@ void ReplayRecorder::SaveReplay()
         callback->isPermanent        = true;
     }
     else {
-        LogHelpers::Print("Can't save replay! No data available");
+        LOG_PRINT("Can't save replay! No data available");
         ActClear::sVars->disableResultsInput = false;
     }
 }
@@ -375,7 +422,7 @@ void ReplayRecorder::SaveReplay()
 void ReplayRecorder::SaveFile_Replay(bool32 success)
 {
     if (success) {
-        LogHelpers::Print("Replay save successful!");
+        LOG_PRINT("Replay save successful!");
         ReplayDB::SaveDB(&ReplayRecorder::SaveCallback_ReplayDB);
     }
     else {
@@ -467,11 +514,11 @@ void ReplayRecorder::Buffer_PackInPlace(int32 *tempWriteBuffer)
 {
     Replay *replayPtr = (Replay *)tempWriteBuffer;
 
-    LogHelpers::Print("Buffer_PackInPlace(%08x)", tempWriteBuffer);
+    LOG_PRINT("Buffer_PackInPlace(%08x)", tempWriteBuffer);
 
     if (replayPtr->header.signature == REPLAY_SIGNATURE) {
         if (replayPtr->header.isPacked) {
-            LogHelpers::Print("Buffer_Ppack ERROR: Buffer is already packed");
+            LOG_PRINT("Buffer_Ppack ERROR: Buffer is already packed");
         }
         else {
             int32 compressedSize   = sizeof(ReplayHeader);
@@ -490,20 +537,20 @@ void ReplayRecorder::Buffer_PackInPlace(int32 *tempWriteBuffer)
                 compressedSize += size;
                 framePtr++;
             }
-            LogHelpers::Print("Packed %d frames: %luB -> %luB", replayPtr->header.frameCount, uncompressedSize, compressedSize);
+            LOG_PRINT("Packed %d frames: %luB -> %luB", replayPtr->header.frameCount, uncompressedSize, compressedSize);
 
             replayPtr->header.bufferSize = compressedSize;
             replayPtr->header.isPacked   = true;
         }
     }
     else {
-        LogHelpers::Print("Buffer_Pack ERROR: Signature does not match");
+        LOG_PRINT("Buffer_Pack ERROR: Signature does not match");
     }
 }
 
 void ReplayRecorder::Buffer_Unpack(int32 *readBuffer, int32 *tempReadBuffer)
 {
-    LogHelpers::Print("Buffer_Unpack(0x%08x, 0x%08x)", readBuffer, tempReadBuffer);
+    LOG_PRINT("Buffer_Unpack(0x%08x, 0x%08x)", readBuffer, tempReadBuffer);
     Replay *replayPtr     = (Replay *)readBuffer;
     Replay *tempReplayPtr = (Replay *)tempReadBuffer;
 
@@ -525,24 +572,24 @@ void ReplayRecorder::Buffer_Unpack(int32 *readBuffer, int32 *tempReadBuffer)
                 compressedFrames += size;
                 uncompressedBuffer++;
             }
-            LogHelpers::Print("Unpacked %d frames: %luB -> %luB", tempReplayPtr->header.frameCount, compressedSize, uncompressedSize);
+            LOG_PRINT("Unpacked %d frames: %luB -> %luB", tempReplayPtr->header.frameCount, compressedSize, uncompressedSize);
 
             replayPtr->header.isPacked   = false;
             replayPtr->header.bufferSize = uncompressedSize;
-            memset(tempReadBuffer, 0, sizeof(globals->replayTempRBuffer));
+            memset(tempReadBuffer, 0, REPLAY_BUFFER_SIZE);
         }
         else {
-            LogHelpers::Print("Buffer_Unpack ERROR: Buffer is not packed");
+            LOG_PRINT("Buffer_Unpack ERROR: Buffer is not packed");
         }
     }
     else {
-        LogHelpers::Print("Buffer_Unpack ERROR: Signature does not match");
+        LOG_PRINT("Buffer_Unpack ERROR: Signature does not match");
     }
 }
 
 void ReplayRecorder::Buffer_SaveFile(const char *fileName, int32 *buffer, void (*callback)(bool32 success))
 {
-    LogHelpers::Print("Buffer_SaveFile(%s, %08x)", fileName, buffer);
+    LOG_PRINT("Buffer_SaveFile(%s, %08x)", fileName, buffer);
 
     Replay *replayPtr = (Replay *)buffer;
     if (replayPtr->header.isNotEmpty) {
@@ -550,7 +597,7 @@ void ReplayRecorder::Buffer_SaveFile(const char *fileName, int32 *buffer, void (
         APITable->SaveUserFile(fileName, buffer, replayPtr->header.bufferSize, ReplayRecorder::SaveReplayCallback, true);
     }
     else {
-        LogHelpers::Print("Attempted to save an empty replay buffer");
+        LOG_PRINT("Attempted to save an empty replay buffer");
         if (callback)
             callback(false);
     }
@@ -566,14 +613,14 @@ void ReplayRecorder::SaveReplayCallback(int32 status)
 
 void ReplayRecorder::Buffer_LoadFile(const char *fileName, void *buffer, void (*callback)(bool32 success))
 {
-    LogHelpers::Print("Buffer_LoadFile(%s, %08x)", fileName, buffer);
+    LOG_PRINT("Buffer_LoadFile(%s, %08x)", fileName, buffer);
 
-    memset(buffer, 0, sizeof(globals->replayReadBuffer));
+    memset(buffer, 0, REPLAY_BUFFER_SIZE);
     sVars->fileBuffer   = buffer;
     sVars->loadCallback = callback;
     strcpy(sVars->filename, fileName);
 
-    API::Storage::LoadUserFile(fileName, buffer, sizeof(globals->replayReadBuffer), ReplayRecorder::LoadReplayCallback);
+    API::Storage::LoadUserFile(fileName, buffer, REPLAY_BUFFER_SIZE, ReplayRecorder::LoadReplayCallback);
 }
 
 void ReplayRecorder::LoadReplayCallback(int32 status)
@@ -590,10 +637,10 @@ void ReplayRecorder::ConfigureGhost_CB()
 {
     Player *player = (Player *)this;
 
-    LogHelpers::Print("ConfigureGhost_CB()");
-    LogHelpers::Print("Ghost Slot %d", player->playerID);
+    LOG_PRINT("ConfigureGhost_CB()");
+    LOG_PRINT("Ghost Slot %d", player->playerID);
 
-    LogHelpers::PrintVector2("Ghost pos ", player->position);
+    LOG_PRINT_VECTOR2("Ghost pos ", player->position);
     player->isGhost        = true;
     player->stateInput.Set(nullptr);
     player->state.Set(&ReplayRecorder::PlayerState_PlaybackReplay);
@@ -685,10 +732,10 @@ void ReplayRecorder::SetupWriteBuffer()
     replayPtr->header.oscillation   = Zone::sVars->timer;
     replayPtr->header.bufferSize    = sizeof(ReplayHeader);
 
-    LogHelpers::Print("characterID = %d", replayPtr->header.characterID);
-    LogHelpers::Print("zoneID = %d", replayPtr->header.zoneID);
-    LogHelpers::Print("act = %d", replayPtr->header.act);
-    LogHelpers::Print("oscillation = %d", replayPtr->header.oscillation);
+    LOG_PRINT("characterID = %d", replayPtr->header.characterID);
+    LOG_PRINT("zoneID = %d", replayPtr->header.zoneID);
+    LOG_PRINT("act = %d", replayPtr->header.act);
+    LOG_PRINT("oscillation = %d", replayPtr->header.oscillation);
 }
 
 void ReplayRecorder::DrawGhostDisplay()
@@ -767,7 +814,7 @@ void ReplayRecorder::DrawGhostDisplay()
 
 void ReplayRecorder::Record(ReplayRecorder *recorder, Player *player)
 {
-    LogHelpers::Print("ReplayRecorder::Record()");
+    LOG_PRINT("ReplayRecorder::Record()");
 
     if (player)
         recorder->player = player;
@@ -782,11 +829,11 @@ void ReplayRecorder::Record(ReplayRecorder *recorder, Player *player)
 void ReplayRecorder::StartRecording(Player *player)
 {
     ReplayRecorder *recorder = sVars->recordingManager;
-    LogHelpers::Print("ReplayRecorder::StartRecording()");
+    LOG_PRINT("ReplayRecorder::StartRecording()");
 
     recorder->active = ACTIVE_NORMAL;
-    memset(globals->replayTempWBuffer, 0, sizeof(globals->replayTempWBuffer));
-    memset(globals->replayWriteBuffer, 0, sizeof(globals->replayWriteBuffer));
+    memset(globals->replayTempWBuffer, 0, REPLAY_BUFFER_SIZE);
+    memset(globals->replayWriteBuffer, 0, REPLAY_BUFFER_SIZE);
 
     ReplayRecorder::Rewind(recorder);
     ReplayRecorder::SetupWriteBuffer();
@@ -795,7 +842,7 @@ void ReplayRecorder::StartRecording(Player *player)
 
 void ReplayRecorder::Play(Player *player)
 {
-    LogHelpers::Print("ReplayRecorder::Play()");
+    LOG_PRINT("ReplayRecorder::Play()");
     ReplayRecorder *recorder = sVars->playbackManager;
 
     Replay *replayPtr = nullptr;
@@ -830,20 +877,20 @@ void ReplayRecorder::Play(Player *player)
         Graphics::SetVideoSetting(VIDEOSETTING_DIMTIMER, 15 * 60 * 60);
     }
     else {
-        LogHelpers::Print("No replay to play");
+        LOG_PRINT("No replay to play");
     }
 }
 
 void ReplayRecorder::Rewind(ReplayRecorder *recorder)
 {
-    LogHelpers::Print("ReplayRecorder::Rewind()");
+    LOG_PRINT("ReplayRecorder::Rewind()");
 
     recorder->replayFrame = 0;
 }
 
 void ReplayRecorder::Seek(ReplayRecorder *recorder, uint32 frame)
 {
-    LogHelpers::Print("ReplayRecorder::Seek(%u)", frame);
+    LOG_PRINT("ReplayRecorder::Seek(%u)", frame);
 
     recorder->replayFrame = frame;
 
@@ -896,7 +943,7 @@ void ReplayRecorder::SeekFunc(ReplayRecorder *recorder)
 
 void ReplayRecorder::Stop(ReplayRecorder *recorder)
 {
-    LogHelpers::Print("ReplayRecorder::Stop()");
+    LOG_PRINT("ReplayRecorder::Stop()");
 
     recorder->state.Set(nullptr);
     recorder->stateLate.Set(nullptr);
@@ -914,9 +961,9 @@ void ReplayRecorder::SetGimmickState(ReplayRecorder *recorder, bool32 allowSprit
     if (player) {
         player->tailFrames.Init();
 
-        if (Stage::CheckSceneFolder("MMZ") || Stage::CheckSceneFolder("PSZ2")) {
+        if (Zone::SceneFolder() == SceneIdentity::FolderMMZ || Zone::SceneFolder() == SceneIdentity::FolderPSZ2) {
             if (allowSpriteChanges) {
-                if (Stage::CheckSceneFolder("MMZ")) {
+                if (Zone::SceneFolder() == SceneIdentity::FolderMMZ) {
                     /*switch (player->characterID) {
                         default:
                         case ID_SONIC: player->aniFrames = SizeLaser->sonicFrames; break;
@@ -929,7 +976,7 @@ void ReplayRecorder::SetGimmickState(ReplayRecorder *recorder, bool32 allowSprit
                         case ID_KNUCKLES: player->aniFrames = SizeLaser->knuxFrames; break;
                     }*/
                 }
-                else if (Stage::CheckSceneFolder("PSZ2")) {
+                else if (Zone::SceneFolder() == SceneIdentity::FolderPSZ2) {
                     //player->aniFrames = Ice->aniFrames;
                 }
             }
@@ -1002,13 +1049,13 @@ bool32 ReplayRecorder::CheckPlayerGimmickState(ReplayRecorder *recorder)
 {
     Player *player = recorder->player;
 
-    if (!player || (!Stage::CheckSceneFolder("MMZ") && !Stage::CheckSceneFolder("PSZ2")))
+    if (!player || (Zone::SceneFolder() != SceneIdentity::FolderMMZ && Zone::SceneFolder() != SceneIdentity::FolderPSZ2))
         return false;
 
-    if (Stage::CheckSceneFolder("MMZ"))
+    if (Zone::SceneFolder() == SceneIdentity::FolderMMZ)
         return player->isChibi;
 
-    if (Stage::CheckSceneFolder("PSZ2"))
+    if (Zone::SceneFolder() == SceneIdentity::FolderPSZ2)
         return player->state.Set(nullptr);
         //return player->state == Ice_PlayerState_Frozen;
 
@@ -1108,7 +1155,7 @@ void ReplayRecorder::PlayBackInput()
 
 void ReplayRecorder::Pause(ReplayRecorder *recorder)
 {
-    LogHelpers::Print("ReplayRecorder::Pause()");
+    LOG_PRINT("ReplayRecorder::Pause()");
 
     recorder->paused = true;
 }
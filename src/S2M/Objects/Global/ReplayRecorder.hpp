@@ -11,6 +11,8 @@ namespace GameLogic
 #define REPLAY_SIGNATURE (0xF6057BED)
 
 #define REPLAY_MAX_FRAMECOUNT (37447)
+// size of each of the globals->replay*Buffer blocks
+#define REPLAY_BUFFER_SIZE (0x40000 * sizeof(int32))
 
 struct ReplayRecorder : RSDK::GameObject::Entity {
 
@@ -158,6 +160,8 @@ struct ReplayRecorder : RSDK::GameObject::Entity {
     // FUNCTIONS
     // ==============================
 
+    static bool32 AcquireBuffers();
+    static void ReleaseBuffers();
     void TitleCardCB();
     static void Resume(ReplayRecorder *recorder);
     void StartCB();
@@ -22,10 +22,85 @@ namespace GameLogic
 {
 RSDK_REGISTER_STATIC_VARS(SaveGame);
 
+// SaveData.bin is only rewritten once the journal fills up, every other save just writes the parts of saveRAM that changed to a journal file
+// savedImage is what loading the files back would give, which is what saveRAM gets compared against to find what changed
+// the storage API can only write whole files, so the journal goes back & forth between two of them. a write that tears only ever damages the
+// file being written, the other one still holds every save up to the one before it
+// these need to outlive any one scene, so they're kept out of sVars
+static const char *journalFiles[] = { "SaveData.jnl", "SaveData2.jnl" };
+
+static int32 savedImage[sizeof(GlobalVariables::saveRAM) / sizeof(int32)];
+static uint8 journal[SAVEGAME_JOURNAL_SIZE];
+static uint8 altJournal[SAVEGAME_JOURNAL_SIZE];
+static int32 journalStatus    = STATUS_NONE;
+static int32 journalFile      = 0;
+static uint32 journalSize     = 0;
+static uint32 journalSequence = 0;
+static bool32 forceCompact    = true;
+
+static uint32 SaveChecksum(const void *data, uint32 size, uint32 hash)
+{
+    // FNV-1a
+    const uint8 *bytes = (const uint8 *)data;
+    for (uint32 i = 0; i < size; ++i) hash = (hash ^ bytes[i]) * 0x01000193;
+    return hash;
+}
+
+static uint32 EntryChecksum(SaveGame::JournalEntry *entry, const void *data)
+{
+    uint32 hash = SaveChecksum(&entry->offset, sizeof(entry->offset), 0x811C9DC5);
+    hash        = SaveChecksum(&entry->size, sizeof(entry->size), hash);
+    return SaveChecksum(data, entry->size, hash);
+}
+
+static void ResetJournal()
+{
+    SaveGame::JournalHeader *header = (SaveGame::JournalHeader *)journal;
+    header->signature               = SAVEGAME_JOURNAL_SIGNATURE;
+    header->baseChecksum            = SaveChecksum(savedImage, sizeof(savedImage), 0x811C9DC5);
+    journalSize                     = sizeof(SaveGame::JournalHeader);
+}
+
+// a journal only counts if the whole file made it to disk & it was started on top of the SaveData.bin that's loaded
+static bool32 CheckJournal(uint8 *data, int32 status, uint32 baseChecksum)
+{
+    SaveGame::JournalHeader *header = (SaveGame::JournalHeader *)data;
+    if (status != STATUS_OK || header->signature != SAVEGAME_JOURNAL_SIGNATURE || header->baseChecksum != baseChecksum)
+        return false;
+
+    if (header->size < sizeof(SaveGame::JournalHeader) || header->size > SAVEGAME_JOURNAL_SIZE)
+        return false;
+
+    uint32 headerSize = sizeof(SaveGame::JournalHeader);
+    return SaveChecksum(&data[headerSize], header->size - headerSize, 0x811C9DC5) == header->checksum;
+}
+
+// writes the whole journal over the older of the two files, which then becomes the newer one
+static void WriteJournal()
+{
+    SaveGame::JournalHeader *header = (SaveGame::JournalHeader *)journal;
+    uint32 headerSize               = sizeof(SaveGame::JournalHeader);
+    header->sequence                = ++journalSequence;
+    header->size                    = journalSize;
+    header->checksum                = SaveChecksum(&journal[headerSize], journalSize - headerSize, 0x811C9DC5);
+
+    journalFile ^= 1;
+    API::Storage::SaveUserFile(journalFiles[journalFile], journal, journalSize, SaveGame::SaveFileCB, false);
+}
+
 void SaveGame::StageLoad() { SaveGame::LoadSaveData(); }
 
 void SaveGame::LoadSaveData()
 {
+    // SaveGame only registers its static vars so its StageLoad never runs, this is called once per scene (from DialogRunner::StageLoad)
+    // the snapshot has to be taken before RecallCollectedEntities below clears out anything that was destroyed last time
+    sVars->sceneSlotCount     = 0;
+    sVars->brokenItemBoxCount = 0;
+    for (int32 e = RESERVE_ENTITY_COUNT; e < RESERVE_ENTITY_COUNT + SCENEENTITY_COUNT; ++e) {
+        if (GameObject::Get(e)->classID)
+            sVars->sceneSlots[sVars->sceneSlotCount++] = e;
+    }
+
     int32 slot = globals->saveSlotID;
 
     sVars->saveRAM = GetSaveDataPtr(slot);
@@ -104,10 +179,13 @@ void SaveGame::RecallCollectedEntities()
     globals->restart1UP          = 100;
     globals->restartPowerups     = 0;
 
-    LogHelpers::Print("RecallCollectedEntities");
+    LOG_PRINT("RecallCollectedEntities");
 
+    // only the slots StoreStageState listed can be anything other than RecallNormal
     int32 *atlEntityData = (int32 *)globals->atlEntityData;
-    for (int32 e = RESERVE_ENTITY_COUNT; e < RESERVE_ENTITY_COUNT + SCENEENTITY_COUNT; ++e) {
+    for (int32 i = 0; i < globals->recallSlotCount; ++i) {
+        int32 e = globals->recallSlots[i];
+
         switch (atlEntityData[(0x200 * 1) + e]) {
             default:
             case SaveGame::RecallNormal: break;
@@ -126,36 +204,114 @@ void SaveGame::RecallCollectedEntities()
                 itemBox->debrisAnimator.SetAnimation(nullptr, 0, true, 0);
                 itemBox->contentsAnimator.SetAnimation(nullptr, 0, true, 0);
                 itemBox->state.Set(&ItemBox::State_Done);
+                SaveGame::RecordBrokenItemBox(e);
                 break;
             }
         }
+
+        atlEntityData[(0x200 * 1) + e] = SaveGame::RecallNormal;
     }
 
     globals->recallEntities      = false;
     globals->restartMilliseconds = 0;
     globals->restartSeconds      = 0;
     globals->restartMinutes      = 0;
+    globals->recallSlotCount     = 0;
     memset(globals->atlEntityData, 0, SCENEENTITY_COUNT * sizeof(int32));
 }
 
 void SaveGame::LoadFileCB(int32 status)
 {
-    bool32 success = false;
     if (status == STATUS_OK || status == STATUS_NOTFOUND) {
-        success             = true;
-        globals->saveLoaded = STATUS_OK;
+        // a missing SaveData.bin is the same as an empty one, there could still be a journal on top of it
+        if (status == STATUS_NOTFOUND)
+            memset(globals->saveRAM, 0, sizeof(globals->saveRAM));
+
+        memcpy(savedImage, globals->saveRAM, sizeof(savedImage));
+        memset(journal, 0, sizeof(journal));
+        API::Storage::LoadUserFile(journalFiles[0], journal, sizeof(journal), SaveGame::LoadJournalCB);
+        return;
+    }
+
+    globals->saveLoaded = STATUS_ERROR;
+
+    if (sVars->loadCallback) {
+        void *store = sceneInfo->entity;
+        if (sVars->loadEntityPtr)
+            sceneInfo->entity = sVars->loadEntityPtr;
+
+        sVars->loadCallback(false);
+        sceneInfo->entity = store;
+
+        sVars->loadCallback  = nullptr;
+        sVars->loadEntityPtr = nullptr;
+    }
+}
+
+void SaveGame::LoadJournalCB(int32 status)
+{
+    journalStatus = status;
+    memset(altJournal, 0, sizeof(altJournal));
+    API::Storage::LoadUserFile(journalFiles[1], altJournal, sizeof(altJournal), SaveGame::LoadAltJournalCB);
+}
+
+void SaveGame::LoadAltJournalCB(int32 status)
+{
+    uint32 baseChecksum = SaveChecksum(savedImage, sizeof(savedImage), 0x811C9DC5);
+
+    // a journal started on an older SaveData.bin was already folded into this one before it could be cleared, so it's skipped
+    // out of the two that are left, the newer one already holds everything the older one does
+    bool32 valid    = CheckJournal(journal, journalStatus, baseChecksum);
+    bool32 altValid = CheckJournal(altJournal, status, baseChecksum);
+    if (altValid && (!valid || ((JournalHeader *)altJournal)->sequence > ((JournalHeader *)journal)->sequence)) {
+        memcpy(journal, altJournal, sizeof(journal));
+        journalFile = 1;
+        valid       = true;
     }
     else {
-        success             = false;
-        globals->saveLoaded = STATUS_ERROR;
+        journalFile = 0;
     }
 
+    JournalHeader *header = (JournalHeader *)journal;
+    uint32 replayed       = 0;
+    if (valid) {
+        uint32 pos = sizeof(JournalHeader);
+
+        // the file as a whole already checked out, this just makes sure every entry stays inside saveRAM
+        while (pos + sizeof(JournalEntry) <= header->size) {
+            JournalEntry *entry = (JournalEntry *)&journal[pos];
+            uint8 *data         = &journal[pos + sizeof(JournalEntry)];
+
+            if (!entry->size || (entry->size & 3) || entry->offset > sizeof(savedImage) || entry->size > sizeof(savedImage) - entry->offset
+                || entry->size > header->size - pos - sizeof(JournalEntry) || EntryChecksum(entry, data) != entry->checksum)
+                break;
+
+            memcpy((uint8 *)globals->saveRAM + entry->offset, data, entry->size);
+            pos += sizeof(JournalEntry) + entry->size;
+            replayed++;
+        }
+
+        memcpy(savedImage, globals->saveRAM, sizeof(savedImage));
+        journalSize     = pos;
+        journalSequence = header->sequence;
+        forceCompact    = false;
+    }
+    else {
+        ResetJournal();
+        // whatever the journal files are holding doesn't belong to this SaveData.bin, so they have to be replaced before anything gets added
+        forceCompact = journalStatus != STATUS_NOTFOUND || status != STATUS_NOTFOUND;
+    }
+
+    LOG_PRINT("LoadAltJournalCB(%d, %d): replayed %d entries from %s", journalStatus, status, replayed, journalFiles[journalFile]);
+
+    globals->saveLoaded = STATUS_OK;
+
     if (sVars->loadCallback) {
         void *store = sceneInfo->entity;
         if (sVars->loadEntityPtr)
             sceneInfo->entity = sVars->loadEntityPtr;
 
-        sVars->loadCallback(success);
+        sVars->loadCallback(true);
         sceneInfo->entity = store;
 
         sVars->loadCallback  = nullptr;
@@ -165,6 +321,10 @@ void SaveGame::LoadFileCB(int32 status)
 
 void SaveGame::SaveFileCB(int32 status)
 {
+    // if the write didn't go through, there's no telling what's on disk anymore so the next save writes everything
+    if (status != STATUS_OK)
+        forceCompact = true;
+
     if (sVars->saveCallback) {
         void *store = sceneInfo->entity;
         if (sVars->saveEntityPtr)
@@ -227,15 +387,75 @@ void SaveGame::SaveFile(void (*callback)(bool32 success))
             callback(false);
     }
     else {
-        sVars->saveEntityPtr = sceneInfo->entity;
-        sVars->saveCallback  = callback;
-        API::Storage::SaveUserFile("SaveData.bin", globals->saveRAM, sizeof(globals->saveRAM), SaveGame::SaveFileCB, false);
+        SaveGame::WriteSaveRAM(callback);
+    }
+}
+
+void SaveGame::CompactFileCB(int32 status)
+{
+    if (status != STATUS_OK) {
+        SaveGame::SaveFileCB(status);
+        return;
+    }
+
+    // SaveData.bin is up to date, so the journal can start over on top of it
+    WriteJournal();
+}
+
+void SaveGame::WriteSaveRAM(void (*callback)(bool32 success))
+{
+    sVars->saveEntityPtr = sceneInfo->entity;
+    sVars->saveCallback  = callback;
+
+    uint8 *saveRAM = (uint8 *)globals->saveRAM;
+    uint8 *image   = (uint8 *)savedImage;
+    uint32 size    = journalSize;
+    bool32 compact = forceCompact;
+
+    // group any changed blocks that touch into a single entry
+    for (uint32 block = 0; block < sizeof(savedImage) && !compact;) {
+        if (!memcmp(&saveRAM[block], &image[block], SAVEGAME_DIRTY_BLOCK)) {
+            block += SAVEGAME_DIRTY_BLOCK;
+            continue;
+        }
+
+        uint32 start = block;
+        while (block < sizeof(savedImage) && memcmp(&saveRAM[block], &image[block], SAVEGAME_DIRTY_BLOCK)) block += SAVEGAME_DIRTY_BLOCK;
+
+        JournalEntry entry;
+        entry.offset = start;
+        entry.size   = block - start;
+        if (size + sizeof(JournalEntry) + entry.size > sizeof(journal)) {
+            compact = true;
+            break;
+        }
+
+        entry.checksum = EntryChecksum(&entry, &saveRAM[start]);
+        memcpy(&journal[size], &entry, sizeof(JournalEntry));
+        memcpy(&journal[size + sizeof(JournalEntry)], &saveRAM[start], entry.size);
+        size += sizeof(JournalEntry) + entry.size;
+    }
+
+    if (compact) {
+        memcpy(savedImage, globals->saveRAM, sizeof(savedImage));
+        ResetJournal();
+        forceCompact = false;
+        API::Storage::SaveUserFile("SaveData.bin", globals->saveRAM, sizeof(globals->saveRAM), SaveGame::CompactFileCB, false);
+    }
+    else if (size == journalSize) {
+        // nothing's changed since the last save
+        SaveGame::SaveFileCB(STATUS_OK);
+    }
+    else {
+        memcpy(savedImage, globals->saveRAM, sizeof(savedImage));
+        journalSize = size;
+        WriteJournal();
     }
 }
 
 void SaveGame::SaveLoadedCB(bool32 success)
 {
-    LogHelpers::Print("SaveLoadedCB(%d)", success);
+    LOG_PRINT("SaveLoadedCB(%d)", success);
 
     if (success) {
         for (auto entity : GameObject::GetEntities<UISaveSlot>(FOR_ALL_ENTITIES))
@@ -297,9 +517,7 @@ void SaveGame::ClearSaveSlot(uint8 slotID, void (*callback)(bool32 success))
     memset(saveSlot, 0, 0x400);
 
     if (sVars->saveRAM && globals->saveLoaded == STATUS_OK) {
-        sVars->saveEntityPtr = sceneInfo->entity;
-        sVars->saveCallback  = callback;
-        API::Storage::SaveUserFile("SaveData.bin", &globals->saveRAM, sizeof(globals->saveRAM), SaveGame::SaveFileCB, false);
+        SaveGame::WriteSaveRAM(callback);
     }
     else if (callback) {
         callback(false);
@@ -313,6 +531,9 @@ void SaveGame::ClearRestartData()
     globals->restartSeconds      = 0;
     globals->restartMinutes      = 0;
     memset(globals->atlEntityData, 0, (RESERVE_ENTITY_COUNT + SCENEENTITY_COUNT) * sizeof(int32));
+
+    for (int32 i = 0; i < globals->recallSlotCount; ++i) globals->atlEntityData[(0x200 * 1) + globals->recallSlots[i]] = SaveGame::RecallNormal;
+    globals->recallSlotCount = 0;
 }
 
 void SaveGame::StoreStageState() {
@@ -349,18 +570,40 @@ void SaveGame::StoreStageState() {
     globals->restart1UP      = player1->ringExtraLife;
     globals->restartPowerups = player1->shield | (player1->hyperRing << 6);
 
+    // atlEntityData keeps one entry per scene slot like it always has, but only the slots that aren't RecallNormal get written (and listed)
     int32 *atlEntityData = (int32 *)globals->atlEntityData;
-    for (int32 i = RESERVE_ENTITY_COUNT; i < RESERVE_ENTITY_COUNT + SCENEENTITY_COUNT; ++i) {
-        ItemBox *itemBox = GameObject::Get<ItemBox>(i);
+    for (int32 i = 0; i < globals->recallSlotCount; ++i) atlEntityData[(0x200 * 1) + globals->recallSlots[i]] = SaveGame::RecallNormal;
+    globals->recallSlotCount = 0;
 
-        atlEntityData[(0x200 * 1) + i] = SaveGame::RecallNormal;
-        if (!itemBox->classID && itemBox->active == ACTIVE_DISABLED)
-            atlEntityData[(0x200 * 1) + i] = SaveGame::RecallDisabled;
-        else if (itemBox->classID == ItemBox::sVars->classID && itemBox->state.Matches(&ItemBox::State_Done))
-            atlEntityData[(0x200 * 1) + i] = SaveGame::RecallBrokenItemBox;
+    for (int32 i = 0; i < sVars->sceneSlotCount; ++i) {
+        int32 slot     = sVars->sceneSlots[i];
+        Entity *entity = GameObject::Get<Entity>(slot);
+
+        if (!entity->classID && entity->active == ACTIVE_DISABLED) {
+            atlEntityData[(0x200 * 1) + slot]                  = SaveGame::RecallDisabled;
+            globals->recallSlots[globals->recallSlotCount++] = slot;
+        }
+    }
+
+    for (int32 i = 0; i < sVars->brokenItemBoxCount; ++i) {
+        int32 slot       = sVars->brokenItemBoxes[i];
+        ItemBox *itemBox = GameObject::Get<ItemBox>(slot);
+
+        if (itemBox->classID == ItemBox::sVars->classID && itemBox->state.Matches(&ItemBox::State_Done)) {
+            atlEntityData[(0x200 * 1) + slot]                  = SaveGame::RecallBrokenItemBox;
+            globals->recallSlots[globals->recallSlotCount++] = slot;
+        }
     }
 }
 
+void SaveGame::RecordBrokenItemBox(uint16 slot)
+{
+    if (slot < RESERVE_ENTITY_COUNT || slot >= RESERVE_ENTITY_COUNT + SCENEENTITY_COUNT || sVars->brokenItemBoxCount >= SCENEENTITY_COUNT)
+        return;
+
+    sVars->brokenItemBoxes[sVars->brokenItemBoxCount++] = slot;
+}
+
 void SaveGame::SavePlayerState()
 {
     SaveRAM *saveRAM = GetSaveRAM();
@@ -4,6 +4,12 @@
 namespace GameLogic
 {
 
+// once the journal would grow past this it gets folded back into SaveData.bin
+#define SAVEGAME_JOURNAL_SIZE (0x4000)
+// saveRAM is compared against what's on disk in blocks this size (in bytes), touching any field in one marks the whole block
+#define SAVEGAME_DIRTY_BLOCK      (0x40)
+#define SAVEGAME_JOURNAL_SIGNATURE (0x4C4E4A53) // "SJNL"
+
 struct SaveGame : RSDK::GameObject::Entity {
 
     // ==============================
@@ -67,6 +73,21 @@ struct SaveGame : RSDK::GameObject::Entity {
         int32 playerID;
     };
 
+    struct JournalHeader {
+        uint32 signature;
+        uint32 baseChecksum; // checksum of the SaveData.bin this journal was started on top of
+        uint32 sequence;     // bumped on every write, the higher of the two journal files is the newer one
+        uint32 size;         // including this header
+        uint32 checksum;     // everything after this header, up to size
+    };
+
+    // followed by size bytes of saveRAM, starting at offset
+    struct JournalEntry {
+        uint32 offset;
+        uint32 size;
+        uint32 checksum;
+    };
+
     // ==============================
     // STATIC VARS
     // ==============================
@@ -77,6 +98,12 @@ struct SaveGame : RSDK::GameObject::Entity {
         void *saveEntityPtr;
         void (*saveCallback)(bool32 success);
         SaveRAM *saveRAM;
+        // every scene slot that had an entity in it when the stage loaded, those are the only ones that can have been destroyed since
+        uint16 sceneSlots[SCENEENTITY_COUNT];
+        int32 sceneSlotCount;
+        // item boxes are logged as they break, so storing the stage state doesn't have to go looking for them
+        uint16 brokenItemBoxes[SCENEENTITY_COUNT];
+        int32 brokenItemBoxCount;
     };
 
     // ==============================
@@ -99,7 +126,11 @@ struct SaveGame : RSDK::GameObject::Entity {
     static void LoadSaveData();
     static void RecallCollectedEntities();
     static void LoadFileCB(int32 status);
+    static void LoadJournalCB(int32 status);
+    static void LoadAltJournalCB(int32 status);
     static void SaveFileCB(int32 status);
+    static void CompactFileCB(int32 status);
+    static void WriteSaveRAM(void (*callback)(bool32 success));
     static SaveRAM *GetSaveDataPtr(uint8 saveSlot);
     bool32 CheckDisableRestart();
     static SaveRAM *GetSaveRAM();
@@ -111,6 +142,7 @@ struct SaveGame : RSDK::GameObject::Entity {
     static void ClearSaveSlot(uint8 slotID, void (*callback)(bool32 success));
     static void ClearRestartData();
     static void StoreStageState();
+    static void RecordBrokenItemBox(uint16 slot);
     static void SavePlayerState();
     static void LoadPlayerState();
     static void ResetPlayerState();
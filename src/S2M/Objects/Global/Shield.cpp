@@ -95,6 +95,8 @@ void Shield::Draw()
 
 void Shield::Create(void *data)
 {
+    Player::BumpChildGeneration(this);
+
     this->active  = ACTIVE_NORMAL;
     this->visible = true;
 
@@ -211,7 +213,7 @@ void Shield::State_Insta()
     this->frameFlags = this->shieldAnimator.GetFrameID() & 7;
 
     if (this->player)
-        this->player->invincibleTimer = 1;
+        this->player->SetInvincibleTimer(1);
 
     if (this->shieldAnimator.frameID == this->shieldAnimator.frameCount - 1) {
         this->state.Init(); // no more
@@ -7,6 +7,7 @@
 #include "Spikes.hpp"
 #include "Zone.hpp"
 #include "Shield.hpp"
+#include "Helpers/SolidIndex.hpp"
 
 using namespace RSDK;
 
@@ -185,6 +186,9 @@ void Spikes::Create(void *data)
             this->stateMove = Spikes::MoveHidden;
         }
     }
+
+    if (!sceneInfo->inEditor)
+        SolidIndex::Register(this, SolidIndex::SolidSpikes);
 }
 
 void Spikes::StageLoad()
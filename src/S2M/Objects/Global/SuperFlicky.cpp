@@ -114,8 +114,8 @@ void SuperFlicky::StaticUpdate()
                 Zone::sVars->flickyAttackList[i].classID = TYPE_NONE;
             }
 
-            Entity *target           = GameObject::Get(sVars->targetPlayerID);
-            sVars->activeFlickyCount = 4;
+            Player *target           = GameObject::Get<Player>(sVars->targetPlayerID);
+            sVars->activeFlickyCount = PLAYER_SUPERFLICKY_COUNT;
             for (int32 f = 0; f < sVars->activeFlickyCount; ++f) {
                 SuperFlicky *flicky    = GameObject::Create<SuperFlicky>(0, target->position.x, target->position.y);
                 flicky->isPermanent    = true;
@@ -127,6 +127,11 @@ void SuperFlicky::StaticUpdate()
                 flicky->angle          = 0x100 / sVars->activeFlickyCount * f;
                 flicky->position.x -= (screenInfo->size.x / 2) << 16;
                 flicky->position.y -= (screenInfo->size.x / 2) << 16;
+
+                // keep the owner's handles in slot order, the order the player's attack checks used to visit flickies in
+                int32 h = f;
+                for (; h > 0 && target->superFlickies[h - 1].slot > flicky->Slot(); --h) target->superFlickies[h] = target->superFlickies[h - 1];
+                Player::LinkChild(&target->superFlickies[h], flicky);
             }
             sVars->state = 2;
             break;
@@ -218,6 +223,8 @@ void SuperFlicky::Draw()
 
 void SuperFlicky::Create(void *data)
 {
+    Player::BumpChildGeneration(this);
+
     if (!sceneInfo->inEditor) {
         this->active        = ACTIVE_NORMAL;
         this->visible       = true;
@@ -20,8 +20,11 @@
 #include "SuperSparkle.hpp"
 #include "Animals.hpp"
 #include "Helpers/LogHelpers.hpp"
+#include "Helpers/SolidIndex.hpp"
+#include "Special/HP_Background.hpp"
 #include "Common/Decoration.hpp"
 #include "HUD.hpp"
+#include "Helpers/StateProfiler.hpp"
 
 using namespace RSDK;
 
@@ -49,6 +52,21 @@ GameLogic::StageFolderInfo GameLogic::stageList[] = {
     { "PPZ", "PPZ", 15, 0, true, false, false },          { "HEHZ", "HEHZ", 16, 0, false, false, false },
     { "HEHZ", "HEHZ", 16, 1, false, false, false }
 };
+static const int32 stageListCount = sizeof(GameLogic::stageList) / sizeof(GameLogic::stageList[0]);
+
+GameLogic::SceneIdentity GameLogic::sceneIdentity = { -1, GameLogic::SceneIdentity::FolderUnknown, -1, 0, false, -1 };
+
+// folder name & the zone GetZoneID reports for it, in SceneFolderIDs order
+static const struct {
+    const char *folder;
+    int8 zoneID;
+} sceneFolderList[] = {
+    { "", -1 },          { "LSelect", -1 }, { "LSelect2", -1 }, { "LSelectEx", -1 }, { "Blueprint", -1 }, { "OWZ", 0 },        { "EHZ", 1 },
+    { "EEHZ", -1 },      { "HEHZ", -1 },    { "CPZ", 2 },       { "ARZ", 3 },        { "SWZ", 4 },        { "CNZ", 5 },        { "HTZ", 6 },
+    { "MCZ", 7 },        { "SSZ", 8 },      { "OOZ", 9 },       { "MTZ", 10 },       { "CCZ", 11 },       { "SCZ", -1 },       { "WFZ", -1 },
+    { "SFZ", 12 },       { "DEZ", 13 },     { "HPZ", 14 },      { "PPZ", -1 },       { "HCZ", -1 },       { "MMZ", -1 },       { "PSZ2", -1 },
+    { "Menu", -1 },      { "Logos", -1 },   { "Thanks", -1 },   { "Credits", -1 },   { "Continue", -1 },  { "DAGarden", -1 },  { "Summary", -1 },
+};
 
 void GameLogic::StrCopy(char *dest, uint32 destSize, const char *src)
 {
@@ -123,6 +141,9 @@ void Zone::LateUpdate()
 }
 void Zone::StaticUpdate()
 {
+    // solids that moved last frame get picked up by the next query
+    SolidIndex::MarkStale();
+
     sVars->timer             = (sVars->timer + 1) & 0x7FFF;
     globals->persistentTimer = (globals->persistentTimer + 1) & 0x7FFF;
 
@@ -169,39 +190,17 @@ void Zone::Create(void *data)
 
 void Zone::StageLoad()
 {
-    int32 stageID = 0;
-    if (!sceneInfo->inEditor)
-        stageID = sceneInfo->listData[sceneInfo->listPos].id[0];
+    SolidIndex::Reset();
+    HP_Background::ReleaseCanvas();
 
-    sVars->folderListPos = 0;
-    sVars->actID         = stageList[sVars->folderListPos].actID;
-    sVars->useFolderIDs  = stageList[sVars->folderListPos].useFolderIDs;
+    // hand off whatever the previous scene recorded, so each capture covers a single scene
+    StateProfiler::Export();
 
-    for (int32 i = 0; i < 0x80; ++i) {
-        StageFolderInfo *stage = &stageList[i];
+    Zone::ResolveSceneIdentity();
 
-        if (Stage::CheckSceneFolder(stage->stageFolder)) {
-            if (sceneInfo->inEditor || stage->noActID) {
-                sVars->folderListPos = i;
-                sVars->actID         = stage->actID;
-                sVars->useFolderIDs  = stage->useFolderIDs;
-                i                    = 0x80;
-                break;
-            }
-            else {
-                for (; i < 0x80; ++i) {
-                    stage = &stageList[i];
-                    if ('1' + stage->actID == stageID) {
-                        sVars->folderListPos = i;
-                        sVars->actID         = stage->actID;
-                        sVars->useFolderIDs  = stage->useFolderIDs;
-                        i                    = 0x80;
-                        break;
-                    }
-                }
-            }
-        }
-    }
+    sVars->folderListPos = sceneIdentity.stageListPos >= 0 ? sceneIdentity.stageListPos : 0;
+    sVars->actID         = stageList[sVars->folderListPos].actID;
+    sVars->useFolderIDs  = stageList[sVars->folderListPos].useFolderIDs;
 
     sVars->timer           = 0;
     sVars->autoScrollSpeed = 0;
@@ -276,40 +275,7 @@ void Zone::StageLoad()
     sVars->sfxFail.Get("Stage/Fail.wav");
 }
 
-int32 Zone::GetZoneID()
-{
-    if (Stage::CheckSceneFolder("OWZ"))
-        return OWZ;
-    if (Stage::CheckSceneFolder("EHZ"))
-        return EHZ;
-    if (Stage::CheckSceneFolder("CPZ"))
-        return CPZ;
-    if (Stage::CheckSceneFolder("ARZ"))
-        return ARZ;
-    if (Stage::CheckSceneFolder("SWZ"))
-        return SWZ;
-    if (Stage::CheckSceneFolder("CNZ"))
-        return CNZ;
-    if (Stage::CheckSceneFolder("HTZ"))
-        return HTZ;
-    if (Stage::CheckSceneFolder("MCZ"))
-        return MCZ;
-    if (Stage::CheckSceneFolder("SSZ"))
-        return SSZ;
-    if (Stage::CheckSceneFolder("OOZ"))
-        return OOZ;
-    if (Stage::CheckSceneFolder("MTZ"))
-        return MTZ;
-    if (Stage::CheckSceneFolder("CCZ"))
-        return CCZ;
-    if (Stage::CheckSceneFolder("SFZ"))
-        return SFZ;
-    if (Stage::CheckSceneFolder("DEZ"))
-        return DEZ;
-    if (Stage::CheckSceneFolder("HPZ"))
-        return HPZ;
-    return Invalid;
-}
+int32 Zone::GetZoneID() { return sceneFolderList[Zone::SceneFolder()].zoneID; }
 
 void Zone::HandlePlayerBounds()
 {
@@ -521,8 +487,8 @@ void Zone::StoreEntities(RSDK::Vector2 offset)
         trail->position.y -= offset.y;
 
         for (int32 i = IMAGETRAIL_TRACK_COUNT - 1; i > 0; --i) {
-            trail->statePos[i].x -= offset.x;
-            trail->statePos[i].y -= offset.y;
+            trail->GetRecord(i + 1)->position.x -= offset.x;
+            trail->GetRecord(i + 1)->position.y -= offset.y;
         }
 
         globals->atlEntitySlot[count] = trail->Slot();
@@ -565,6 +531,8 @@ void Zone::ReloadEntities(RSDK::Vector2 offset, bool32 setATLBounds)
 
         entity->position.x = storedEntity->position.x + offset.x;
         entity->position.y = storedEntity->position.y + offset.y;
+
+        SolidIndex::RegisterCopy(entity);
     }
 
     // clear ATL data, we dont wanna do it again
@@ -697,41 +665,77 @@ void Zone::ApplyWorldBounds()
     }
 }
 
-int32 Zone::CurrentID()
+void Zone::ResolveSceneIdentity()
 {
-    SET_CURRENT_STATE();
+    SceneIdentity *identity = &sceneIdentity;
 
-    for (int32 i = 0; i < 0x80; ++i) {
-        StageFolderInfo *stage = &stageList[i];
+    identity->sceneListPos = sceneInfo->listPos;
+    identity->folderID     = SceneIdentity::FolderUnknown;
+    for (int32 f = 1; f < SceneIdentity::FolderCount; ++f) {
+        if (Stage::CheckSceneFolder(sceneFolderList[f].folder)) {
+            identity->folderID = f;
+            break;
+        }
+    }
+
+    identity->zoneID       = Zone::Invalid;
+    identity->actID        = 0;
+    identity->isSavable    = false;
+    identity->stageListPos = -1;
+
+    int32 stageID = 0;
+    if (!sceneInfo->inEditor)
+        stageID = sceneInfo->listData[sceneInfo->listPos].id[0];
+
+    for (int32 i = 0; i < stageListCount; ++i) {
+        if (!Stage::CheckSceneFolder(stageList[i].stageFolder))
+            continue;
 
-        if (Stage::CheckSceneFolder(stage->stageFolder))
-            return stage->zoneID;
+        identity->zoneID = stageList[i].zoneID;
+
+        if (sceneInfo->inEditor || stageList[i].noActID) {
+            identity->stageListPos = i;
+        }
+        else {
+            for (; i < stageListCount; ++i) {
+                if ('1' + stageList[i].actID == stageID) {
+                    identity->stageListPos = i;
+                    break;
+                }
+            }
+        }
+        break;
+    }
+
+    if (identity->stageListPos >= 0) {
+        identity->actID     = stageList[identity->stageListPos].actID;
+        identity->isSavable = stageList[identity->stageListPos].isSavable;
     }
-    return -1;
 }
 
-bool32 Zone::CurrentStageSaveable()
+SceneIdentity *Zone::GetSceneIdentity()
 {
-    SET_CURRENT_STATE();
+    // Zone::StageLoad resolves this, but not every scene has a zone object, so anything else just resolves it the first time it asks
+    if (sceneInfo->inEditor || sceneIdentity.sceneListPos != sceneInfo->listPos)
+        Zone::ResolveSceneIdentity();
 
-    int32 stageID = sceneInfo->listData[sceneInfo->listPos].id[0];
+    return &sceneIdentity;
+}
 
-    for (int32 i = 0; i < 0x80; ++i) {
-        StageFolderInfo *stage = &stageList[i];
+uint8 Zone::SceneFolder() { return Zone::GetSceneIdentity()->folderID; }
 
-        if (Stage::CheckSceneFolder(stage->stageFolder)) {
-            if (stage->noActID)
-                return stage->isSavable;
+int32 Zone::CurrentID()
+{
+    SET_CURRENT_STATE();
 
-            for (; i < 0x80; ++i) {
-                stage = &stageList[i];
+    return Zone::GetSceneIdentity()->zoneID;
+}
 
-                if (stageID == '1' + stage->actID)
-                    return stage->isSavable;
-            }
-        }
-    }
-    return false;
+bool32 Zone::CurrentStageSaveable()
+{
+    SET_CURRENT_STATE();
+
+    return Zone::GetSceneIdentity()->isSavable;
 }
 
 int32 Zone::GetListPos(uint8 zone, uint8 act)
@@ -803,6 +807,60 @@ void Zone::GetTileInfo(int32 x, int32 y, int32 moveOffsetX, int32 moveOffsetY, i
     }
 }
 
+// clips a tile rect to the layer, srcX & srcY return how far into the rect the clipped one starts
+static TileLayer *ClipTileRegion(uint16 layerID, int32 *x, int32 *y, int32 *width, int32 *height, int32 *srcX, int32 *srcY)
+{
+    TileLayer *layer = SceneLayer::GetTileLayer(layerID);
+    if (!layer || !layer->layout)
+        return nullptr;
+
+    *srcX = 0;
+    *srcY = 0;
+    if (*x < 0) {
+        *srcX = -*x;
+        *width += *x;
+        *x = 0;
+    }
+    if (*y < 0) {
+        *srcY = -*y;
+        *height += *y;
+        *y = 0;
+    }
+
+    *width  = MIN(*width, layer->xsize - *x);
+    *height = MIN(*height, layer->ysize - *y);
+    return *width > 0 && *height > 0 ? layer : nullptr;
+}
+
+// bulk versions of SetTile, these write the layout a row at a time
+void Zone::FillTiles(uint16 layerID, int32 x, int32 y, int32 width, int32 height, uint16 tile)
+{
+    int32 srcX, srcY;
+    TileLayer *layer = ClipTileRegion(layerID, &x, &y, &width, &height, &srcX, &srcY);
+    if (!layer)
+        return;
+
+    for (int32 ty = y; ty < y + height; ++ty) {
+        uint16 *row = &layer->layout[x + (ty << layer->widthShift)];
+        for (int32 tx = 0; tx < width; ++tx) row[tx] = tile;
+    }
+}
+
+void Zone::WriteTiles(uint16 layerID, int32 x, int32 y, int32 width, int32 height, RSDK::Tile *tiles)
+{
+    int32 pitch = width;
+    int32 srcX, srcY;
+    TileLayer *layer = ClipTileRegion(layerID, &x, &y, &width, &height, &srcX, &srcY);
+    if (!layer)
+        return;
+
+    for (int32 ty = 0; ty < height; ++ty) {
+        uint16 *row     = &layer->layout[x + ((y + ty) << layer->widthShift)];
+        RSDK::Tile *src = &tiles[srcX + (srcY + ty) * pitch];
+        for (int32 tx = 0; tx < width; ++tx) row[tx] = src[tx].id;
+    }
+}
+
 int32 Zone::GetZoneListPos(int32 zoneID, int32 act, int32 characterID)
 {
     int32 listPos = 0;
@@ -824,8 +882,8 @@ int32 Zone::GetZoneListPos(int32 zoneID, int32 act, int32 characterID)
         default: break;
     }
 
-    LogHelpers::Print("playerID = %d, zoneID = %d, act = %d", characterID, zoneID, act);
-    LogHelpers::Print("listPos = %d", listPos);
+    LOG_PRINT("playerID = %d, zoneID = %d, act = %d", characterID, zoneID, act);
+    LOG_PRINT("listPos = %d", listPos);
 
     return listPos;
 }
@@ -835,37 +893,11 @@ void Zone::EditorDraw() {}
 
 void Zone::EditorLoad()
 {
-    int32 stageID = 0;
-    if (!sceneInfo->inEditor)
-        stageID = sceneInfo->listData[sceneInfo->listPos].id[0];
+    Zone::ResolveSceneIdentity();
 
-    sVars->folderListPos = 0;
+    sVars->folderListPos = sceneIdentity.stageListPos >= 0 ? sceneIdentity.stageListPos : 0;
     sVars->actID         = stageList[sVars->folderListPos].actID;
     sVars->useFolderIDs  = stageList[sVars->folderListPos].useFolderIDs;
-
-    for (int32 i = 0; i < 0x80; ++i) {
-        StageFolderInfo *stage = &stageList[i];
-
-        if (Stage::CheckSceneFolder(stage->stageFolder)) {
-            if (sceneInfo->inEditor || stage->noActID) {
-                sVars->folderListPos = i;
-                sVars->actID         = stage->actID;
-                sVars->useFolderIDs  = stage->useFolderIDs;
-                break;
-            }
-            else {
-                for (; i < 0x80; ++i) {
-                    stage = &stageList[i];
-                    if ('1' + stage->actID == stageID) {
-                        sVars->folderListPos = i;
-                        sVars->actID         = stage->actID;
-                        sVars->useFolderIDs  = stage->useFolderIDs;
-                        break;
-                    }
-                }
-            }
-        }
-    }
 }
 #endif
 
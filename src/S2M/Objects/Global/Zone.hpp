@@ -17,7 +17,57 @@ struct StageFolderInfo {
     bool32 useFolderIDs;
 };
 
+// everything about the current scene that used to be found by comparing folder names, worked out once per scene
+struct SceneIdentity {
+    enum SceneFolderIDs {
+        FolderUnknown,
+        FolderLSelect,
+        FolderLSelect2,
+        FolderLSelectEx,
+        FolderBlueprint,
+        FolderOWZ,
+        FolderEHZ,
+        FolderEEHZ,
+        FolderHEHZ,
+        FolderCPZ,
+        FolderARZ,
+        FolderSWZ,
+        FolderCNZ,
+        FolderHTZ,
+        FolderMCZ,
+        FolderSSZ,
+        FolderOOZ,
+        FolderMTZ,
+        FolderCCZ,
+        FolderSCZ,
+        FolderWFZ,
+        FolderSFZ,
+        FolderDEZ,
+        FolderHPZ,
+        FolderPPZ,
+        FolderHCZ,
+        FolderMMZ,
+        FolderPSZ2,
+        FolderMenu,
+        FolderLogos,
+        FolderThanks,
+        FolderCredits,
+        FolderContinue,
+        FolderDAGarden,
+        FolderSummary,
+        FolderCount,
+    };
+
+    int32 sceneListPos; // the sceneInfo->listPos this was resolved for
+    uint8 folderID;
+    int8 zoneID;
+    uint8 actID;
+    bool32 isSavable;
+    int32 stageListPos; // -1 if the scene isn't in stageList
+};
+
 extern StageFolderInfo stageList[];
+extern SceneIdentity sceneIdentity;
 extern char dynamicPath[0x40];
 extern int32 dynamicPathActID;
 extern int32 dynamicPathUnknown;
@@ -222,11 +272,16 @@ struct Zone : RSDK::GameObject::Entity {
 
     static void ApplyWorldBounds();
 
+    static void ResolveSceneIdentity();
+    static SceneIdentity *GetSceneIdentity();
+    static uint8 SceneFolder();
     static int32 CurrentID();
     static bool32 CurrentStageSaveable();
     static int32 GetListPos(uint8 zone, uint8 act);
 
     static void GetTileInfo(int32 x, int32 y, int32 moveOffsetX, int32 moveOffsetY, int32 cPlane, RSDK::Tile *tile, uint8 *flags);
+    static void FillTiles(uint16 layerID, int32 x, int32 y, int32 width, int32 height, uint16 tile);
+    static void WriteTiles(uint16 layerID, int32 x, int32 y, int32 width, int32 height, RSDK::Tile *tiles);
 
     static int32 GetZoneListPos(int32 zoneID, int32 act, int32 characterID);
 
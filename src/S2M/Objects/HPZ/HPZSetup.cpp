@@ -152,10 +152,10 @@ void HPZSetup::StageLoad()
                 characterText  = "Knuckles";
                 break;
         }
-        if (Stage::CheckSceneFolder("HPZ")) {
+        if (Zone::SceneFolder() == SceneIdentity::FolderHPZ) {
             SetPresence(playingAsText, "In Hidden Palace", "hpz", "Hidden Palace", characterImage, characterText);
         }
-        else if (Stage::CheckSceneFolder("PPZ")) {
+        else if (Zone::SceneFolder() == SceneIdentity::FolderPPZ) {
             SetPresence(playingAsText, "In Proto Palace", "hpz", "Proto Palace", characterImage, characterText);
         }
     }
@@ -220,14 +220,10 @@ bool32 Jellygnite::CheckInWater(Player *player)
     if (player->position.y > Water::sVars->waterLevel)
         return true;
 
-    for (auto water : GameObject::GetEntities<Water>(FOR_ACTIVE_ENTITIES)) 
-    {
-        if (water->type == Water::Pool) {
-            if (player->CheckCollisionTouch(this, &water->hitbox)
-                && this->CheckCollisionTouchBox(&sVars->hitbox, water, &water->hitbox)) {
-                return true;
-            }
-        }
+    for (int32 i = 0; i < Water::sVars->registryCount[Water::RegistryPools]; ++i) {
+        Water *water = Water::GetRegistered(Water::RegistryPools, i, true);
+        if (water && player->CheckCollisionTouch(this, &water->hitbox) && this->CheckCollisionTouchBox(&sVars->hitbox, water, &water->hitbox))
+            return true;
     }
     return false;
 }
@@ -9,6 +9,7 @@
 #include "Global/DebugMode.hpp"
 #include "Global/Zone.hpp"
 #include "OOZ/OOZSetup.hpp"
+#include "Helpers/BadnikHelpers.hpp"
 
 using namespace RSDK;
 
@@ -116,13 +117,22 @@ void Sol::HandlePlayerInteractions()
     for (auto player : GameObject::GetEntities<Player>(FOR_ACTIVE_ENTITIES)) 
     {
         if (player->CheckBadnikTouch(this, &sVars->hitboxBadnik) && player->CheckBadnikBreak(this, false)) {
-            int32 angle = this->angle;
+            int32 orbCount = 0;
+            for (int32 i = 0; i < SOL_FLAMEORB_COUNT; ++i) {
+                if ((1 << i) & this->activeOrbs)
+                    orbCount++;
+            }
+
+            int32 burstSlot = BadnikHelpers::ReserveBurst(orbCount);
+            int32 orbID     = 0;
+            int32 angle     = this->angle;
             for (int32 i = 0; i < SOL_FLAMEORB_COUNT; ++i) {
                 if ((1 << i) & this->activeOrbs) {
                     this->position.x = this->positions[i].x;
                     this->position.y = this->positions[i].y;
 
-                    Sol *sol = GameObject::Create<Sol>(INT_TO_VOID(true), this->positions[i].x, this->positions[i].y);
+                    Sol *sol = BadnikHelpers::SpawnBurstPiece<Sol>(burstSlot, orbID++, INT_TO_VOID(true), this->positions[i].x,
+                                                                    this->positions[i].y);
 
                     sol->state.Set(&Sol::State_ActiveFireball);
                     sol->velocity.x = 0x380 * Math::Cos256(angle);
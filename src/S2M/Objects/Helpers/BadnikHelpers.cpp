@@ -47,6 +47,37 @@ int32 BadnikHelpers::Oscillate(RSDK::GameObject::Entity *self, int32 origin, int
     return ((Math::Sin256(self->angle) << amplitude) + origin) & 0xFFFF0000;
 }
 
+// bursts go in the temp entity range, same as GameObject::Create, but the whole run of free slots is found in one pass
+static int32 burstCursor = 0;
+
+int32 BadnikHelpers::ReserveBurst(int32 count)
+{
+    const int32 tempStart = RESERVE_ENTITY_COUNT + SCENEENTITY_COUNT;
+    const int32 tempCount = ENTITY_COUNT - tempStart;
+    if (count <= 0 || count > tempCount)
+        return -1;
+
+    int32 slot = tempStart + burstCursor;
+    int32 run  = 0;
+    for (int32 i = 0; i < tempCount + count; ++i, ++slot) {
+        // runs can't wrap around the end of the entity list
+        if (slot >= ENTITY_COUNT) {
+            slot = tempStart;
+            run  = 0;
+        }
+
+        if (GameObject::Get(slot)->classID) {
+            run = 0;
+        }
+        else if (++run == count) {
+            burstCursor = (slot + 1 - tempStart) % tempCount;
+            return slot + 1 - count;
+        }
+    }
+
+    return -1;
+}
+
 #if RETRO_REV0U
 void BadnikHelpers::StaticLoad(Static *sVars) { RSDK_INIT_STATIC_VARS(BadnikHelpers); }
 #endif
@@ -14,6 +14,14 @@ struct BadnikHelpers : RSDK::GameObject::Entity {
     // STRUCTS
     // ==============================
 
+    // one piece of a burst, relative to where the burst is spawned
+    struct BurstPiece {
+        int32 offsetX;
+        int32 offsetY;
+        int32 velocityX;
+        int32 velocityY;
+    };
+
     // ==============================
     // STATIC VARS
     // ==============================
@@ -40,6 +48,35 @@ struct BadnikHelpers : RSDK::GameObject::Entity {
     static void BadnikBreakUnseeded(RSDK::GameObject::Entity *badnik, bool32 destroy, bool32 spawnAnimals);
     static int32 Oscillate(RSDK::GameObject::Entity *self, int32 origin, int32 speed, int32 amplitude);
 
+    static int32 ReserveBurst(int32 count);
+
+    // burstSlot comes from ReserveBurst, if that failed (-1) this just falls back to a regular create
+    template <typename T> static inline T *SpawnBurstPiece(int32 burstSlot, int32 id, void *data, int32 x, int32 y)
+    {
+        if (burstSlot < 0)
+            return RSDK::GameObject::Create<T>(data, x, y);
+
+        T *piece = RSDK::GameObject::Get<T>(burstSlot + id);
+        piece->Reset(T::sVars->classID, data);
+        piece->position.x = x;
+        piece->position.y = y;
+        return piece;
+    }
+
+    template <typename T> static inline void SpawnBurst(void *data, int32 x, int32 y, const BurstPiece *pieces, int32 count, T **spawned)
+    {
+        int32 burstSlot = ReserveBurst(count);
+
+        for (int32 i = 0; i < count; ++i) {
+            T *piece          = SpawnBurstPiece<T>(burstSlot, i, data, x + pieces[i].offsetX, y + pieces[i].offsetY);
+            piece->velocity.x = pieces[i].velocityX;
+            piece->velocity.y = pieces[i].velocityY;
+
+            if (spawned)
+                spawned[i] = piece;
+        }
+    }
+
     // ==============================
     // DECLARATION
     // ==============================
@@ -28,12 +28,12 @@ void CutsceneSeq::LateUpdate()
 
         ++this->timer;
         if (finishedState) {
-            LogHelpers::Print("State completed");
+            LOG_PRINT("State completed");
             NewState(this->stateID + 1);
         }
 
         if (!this->cutsceneStates[this->stateID]) {
-            LogHelpers::Print("Sequence completed");
+            LOG_PRINT("Sequence completed");
             this->Destroy();
         }
     }
@@ -63,7 +63,7 @@ void CutsceneSeq::Draw()
     for (int32 p = 0; p < 8; ++p) {
         Vector2 *point = &this->points[p];
         if (point->x || point->y) {
-            LogHelpers::PrintVector2("Draw poi ", *point);
+            LOG_PRINT_VECTOR2("Draw poi ", *point);
             DrawHelpers::DrawCross(point->x, point->y, 0x200000, 0x200000, colors[p]);
         }
     }
@@ -197,12 +197,12 @@ void CutsceneSeq::StartSequence(RSDK::GameObject::Entity *manager, ...)
         if (!state)
             break;
 
-        LogHelpers::Print("state = %x", state);
+        LOG_PRINT("state = %x", state);
         cutsceneSeq->cutsceneStates[count] = (bool32(*)(CutsceneSeq *))state;
     }
     va_end(list);
 
-    LogHelpers::Print("Starting sequence with %d states", count);
+    LOG_PRINT("Starting sequence with %d states", count);
 }
 
 #if RETRO_INCLUDE_EDITOR
@@ -77,7 +77,7 @@ void DialogRunner::StaticLoad(Static *sVars) { RSDK_INIT_STATIC_VARS(DialogRunne
 void DialogRunner::HandleCallback()
 {
     if (this->timer <= 0) {
-        LogHelpers::Print("Callback: %x", this->state);
+        LOG_PRINT("Callback: %x", this->state);
         this->state.Run(this);
         this->Destroy();
     }
@@ -250,7 +250,7 @@ void DialogRunner::TrackGameProgressCB(bool32 success) { UILoadingIcon::FinishWa
 void DialogRunner::GetNextNotif()
 {
     if (sceneInfo->inEditor || API::Storage::GetNoSave() || globals->saveLoaded != STATUS_OK) {
-        LogHelpers::Print("WARNING GameProgress Attempted to save before loading SaveGame file");
+        LOG_PRINT("WARNING GameProgress Attempted to save before loading SaveGame file");
         return;
     }
     else {
@@ -311,14 +311,14 @@ void DialogRunner::GetUserAuthStatus()
 void DialogRunner::PromptSavePreference(int32 id)
 {
     if (API::Storage::GetNoSave()) {
-        LogHelpers::Print("PromptSavePreference() returning due to noSave");
+        LOG_PRINT("PromptSavePreference() returning due to noSave");
         return;
     }
 
-    LogHelpers::Print("PromptSavePreference()");
+    LOG_PRINT("PromptSavePreference()");
 
     if (API::Storage::GetSaveStatus() == STATUS_CONTINUE)
-        LogHelpers::Print("WARNING PromptSavePreference() when prompt already in progress.");
+        LOG_PRINT("WARNING PromptSavePreference() when prompt already in progress.");
 
     API::Storage::ClearSaveStatus();
 
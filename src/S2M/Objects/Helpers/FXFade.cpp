@@ -25,7 +25,7 @@ void FXFade::Create(void *data)
         this->visible = true;
         this->active  = ACTIVE_NORMAL;
 
-        if (Stage::CheckSceneFolder("Menu"))
+        if (Zone::SceneFolder() == SceneIdentity::FolderMenu)
             this->drawGroup = 14;
         else if (Zone::sVars)
             this->drawGroup = this->overHUD ? Zone::sVars->hudDrawGroup : Zone::sVars->hudDrawGroup - 1;
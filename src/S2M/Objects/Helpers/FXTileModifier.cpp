@@ -14,6 +14,38 @@ namespace GameLogic
 {
 RSDK_REGISTER_OBJECT(FXTileModifier);
 
+// modifiers never move once they've snapped to the grid, so GetNearest can search a list sorted by x instead of every modifier
+// scene modifiers are listed by StageLoad & anything created after that (debug mode, other objects) is added by Create
+static uint16 modifierList[ENTITY_COUNT];
+static int32 modifierKeyX[ENTITY_COUNT];
+static int32 modifierCount = 0;
+
+static void InsertModifier(FXTileModifier *modifier)
+{
+    uint16 slot = modifier->Slot();
+
+    // a slot that's been reset or reused for a new modifier drops its old entry first
+    for (int32 m = 0; m < modifierCount; ++m) {
+        if (modifierList[m] == slot) {
+            memmove(&modifierList[m], &modifierList[m + 1], (modifierCount - m - 1) * sizeof(uint16));
+            memmove(&modifierKeyX[m], &modifierKeyX[m + 1], (modifierCount - m - 1) * sizeof(int32));
+            modifierCount--;
+            break;
+        }
+    }
+
+    // the same snap Update applies, so the key matches the modifier's position for good after its first update
+    int32 keyX = modifier->position.x & 0xFFF00000;
+
+    int32 m = modifierCount++;
+    for (; m > 0 && modifierKeyX[m - 1] > keyX; --m) {
+        modifierList[m] = modifierList[m - 1];
+        modifierKeyX[m] = modifierKeyX[m - 1];
+    }
+    modifierList[m] = slot;
+    modifierKeyX[m] = keyX;
+}
+
 void FXTileModifier::Update()
 {
     this->position.x &= 0xFFF00000;
@@ -59,11 +91,7 @@ void FXTileModifier::Update()
 
                     int32 dstX = (this->position.x & 0xFFF80000) >> 20;
                     int32 dstY = (this->position.y & 0xFFF80000) >> 20;
-                    for (int32 y = 0; y < rangeY; ++y) {
-                        for (int32 x = 0; x < rangeX; ++x) {
-                            dstLayer.SetTile(dstX + x, dstY + y, -1);
-                        }
-                    }
+                    Zone::FillTiles(dstLayer.id, dstX, dstY, rangeX, rangeY, -1);
                 }
             }
 
@@ -97,11 +125,7 @@ void FXTileModifier::Update()
 
                     int32 dstX = (this->position.x & 0xFFF80000) >> 20;
                     int32 dstY = (this->position.y & 0xFFF80000) >> 20;
-                    for (int32 y = 0; y < rangeY; ++y) {
-                        for (int32 x = 0; x < rangeX; ++x) {
-                            dstLayer.SetTile(dstX + x, dstY + y, -1);
-                        }
-                    }
+                    Zone::FillTiles(dstLayer.id, dstX, dstY, rangeX, rangeY, -1);
                 }
             }
 
@@ -163,23 +187,59 @@ void FXTileModifier::Create(void *data)
             this->active = ACTIVE_NORMAL;
         else
             this->active = ACTIVE_BOUNDS;
+
+        InsertModifier(this);
     }
 }
 
-void FXTileModifier::StageLoad() { sVars->aniFrames.Load("Editor/EditorIcons.bin", SCOPE_STAGE); }
+void FXTileModifier::StageLoad()
+{
+    sVars->aniFrames.Load("Editor/EditorIcons.bin", SCOPE_STAGE);
+
+    modifierCount = 0;
+    for (auto modifier : GameObject::GetEntities<FXTileModifier>(FOR_ALL_ENTITIES)) InsertModifier(modifier);
+}
 
 FXTileModifier *FXTileModifier::GetNearest(RSDK::GameObject::Entity *self)
 {
     if (!self)
         return nullptr;
 
+    int32 lo = 0;
+    int32 hi = modifierCount;
+    while (lo < hi) {
+        int32 mid = (lo + hi) >> 1;
+        if (modifierKeyX[mid] < self->position.x)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    // walk outwards from self's x until nothing further along could be closer, keys can be up to a (pre-snap) tile off the real position
     int32 targetDistance           = 0x7FFFFFFF;
     FXTileModifier *targetModifier = nullptr;
-    for (auto modifier : GameObject::GetEntities<FXTileModifier>(FOR_ACTIVE_ENTITIES)) {
-        int32 distX = abs(modifier->position.x - self->position.x);
-        int32 distY = abs(modifier->position.y - self->position.y);
-        if (distX + distY < targetDistance) {
-            targetDistance = distX + distY;
+    for (int32 left = lo - 1, right = lo; left >= 0 || right < modifierCount;) {
+        int32 m = -1;
+        if (left < 0)
+            m = right++;
+        else if (right >= modifierCount)
+            m = left--;
+        else if (self->position.x - modifierKeyX[left] <= modifierKeyX[right] - self->position.x)
+            m = left--;
+        else
+            m = right++;
+
+        if (abs(modifierKeyX[m] - self->position.x) - 0x100000 > targetDistance)
+            break;
+
+        FXTileModifier *modifier = GameObject::Get<FXTileModifier>(modifierList[m]);
+        if (modifier->classID != sVars->classID || !modifier->inRange)
+            continue;
+
+        // ties go to the lower slot, same as the old slot-order scan
+        int32 distance = abs(modifier->position.x - self->position.x) + abs(modifier->position.y - self->position.y);
+        if (distance < targetDistance || (distance == targetDistance && targetModifier && modifier->Slot() < targetModifier->Slot())) {
+            targetDistance = distance;
             targetModifier = modifier;
         }
     }
@@ -22,7 +22,7 @@ void GameProgress::Save(void (*callback)(bool32 success))
     GameProgress *progressRAM = GetProgressRAM();
 
     if (sceneInfo->inEditor || globals->saveLoaded != STATUS_OK) {
-        LogHelpers::Print("WARNING GameProgress Attempted to save before loading SaveGame file");
+        LOG_PRINT("WARNING GameProgress Attempted to save before loading SaveGame file");
         if (callback)
             callback(false);
 
@@ -40,47 +40,47 @@ void GameProgress::Save(void (*callback)(bool32 success))
 void GameProgress::DumpProgress()
 {
     if (sceneInfo->inEditor  || globals->saveLoaded != STATUS_OK) {
-        LogHelpers::Print("WARNING GameProgress Attempted to dump before loading SaveGame file");
+        LOG_PRINT("WARNING GameProgress Attempted to dump before loading SaveGame file");
         return;
     }
 
     GameProgress *progress = GetProgressRAM();
 
-    LogHelpers::Print("=========================");
-    LogHelpers::Print("Game Progress:\n");
+    LOG_PRINT("=========================");
+    LOG_PRINT("Game Progress:\n");
 
     for (int32 e = 0; e < 7; ++e) {
         if (progress->emeraldObtained[e])
-            LogHelpers::Print("Emerald %d => TRUE", e);
+            LOG_PRINT("Emerald %d => TRUE", e);
         else
-            LogHelpers::Print("Emerald %d => FALSE", e);
+            LOG_PRINT("Emerald %d => FALSE", e);
     }
 
     if (progress->allEmeraldsObtained)
-        LogHelpers::Print("ALL EMERALDS!\n");
+        LOG_PRINT("ALL EMERALDS!\n");
     else
-        LogHelpers::Print("YOU'VE NOT ENOUGH EMERALDS!\n");
+        LOG_PRINT("YOU'VE NOT ENOUGH EMERALDS!\n");
 
     for (int32 z = 0; z < Zone::ZoneCount; ++z) {
         if (progress->zoneCleared[z])
-            LogHelpers::Print("Zone %d clear => TRUE", z);
+            LOG_PRINT("Zone %d clear => TRUE", z);
         else
-            LogHelpers::Print("Zone %d clear => FALSE", z);
+            LOG_PRINT("Zone %d clear => FALSE", z);
     }
 
     if (progress->unlockedEndingID < 3) {
         const char *endings[] = { "NO ENDING!", "BAD ENDING!", "GOOD ENDING!" };
 
-        LogHelpers::Print(endings[progress->unlockedEndingID]);
+        LOG_PRINT(endings[progress->unlockedEndingID]);
     }
 
-    LogHelpers::Print("\n=========================");
+    LOG_PRINT("\n=========================");
 }
 
 void GameProgress::ClearProgress()
 {
     if (sceneInfo->inEditor || API::Storage::GetNoSave() || globals->saveLoaded != STATUS_OK) {
-        LogHelpers::Print("WARNING GameProgress Attempted to clear all before loading SaveGame file");
+        LOG_PRINT("WARNING GameProgress Attempted to clear all before loading SaveGame file");
         return;
     }
 
@@ -108,7 +108,7 @@ void GameProgress::ClearProgress()
 void GameProgress::MarkZoneCompleted(int32 zoneID)
 {
     if (sceneInfo->inEditor || globals->saveLoaded != STATUS_OK) {
-        LogHelpers::Print("WARNING GameProgress Attempted to mark completed zone before loading SaveGame file");
+        LOG_PRINT("WARNING GameProgress Attempted to mark completed zone before loading SaveGame file");
         return;
     }
 
@@ -116,7 +116,7 @@ void GameProgress::MarkZoneCompleted(int32 zoneID)
         GameProgress *progress = GetProgressRAM();
         for (int32 z = 0; z <= zoneID; ++z) {
             if (!progress->zoneCleared[z]) {
-                LogHelpers::Print("PROGRESS Cleared zone %d", z);
+                LOG_PRINT("PROGRESS Cleared zone %d", z);
                 progress->zoneCleared[z] = true;
             }
         }
@@ -125,7 +125,7 @@ void GameProgress::MarkZoneCompleted(int32 zoneID)
 void GameProgress::CollectEmerald(int32 emeraldID)
 {
     if (sceneInfo->inEditor || globals->saveLoaded != STATUS_OK) {
-        LogHelpers::Print("WARNING GameProgress Attempted to get emerald before loading SaveGame file");
+        LOG_PRINT("WARNING GameProgress Attempted to get emerald before loading SaveGame file");
         return;
     }
 
@@ -172,7 +172,7 @@ int32 GameProgress::GetNotifStringID(int32 type)
 int32 GameProgress::CountUnreadNotifs()
 {
     if (sceneInfo->inEditor || API::Storage::GetNoSave() || globals->saveLoaded != STATUS_OK) {
-        LogHelpers::Print("WARNING GameProgress Attempted to count unread notifs before loading SaveGame file");
+        LOG_PRINT("WARNING GameProgress Attempted to count unread notifs before loading SaveGame file");
         return 0;
     }
     else {
@@ -192,7 +192,7 @@ int32 GameProgress::CountUnreadNotifs()
 int32 GameProgress::GetNextNotif()
 {
     if (sceneInfo->inEditor || API::Storage::GetNoSave() || globals->saveLoaded != STATUS_OK) {
-        LogHelpers::Print("WARNING GameProgress Attempted to get next unread notif before loading SaveGame file");
+        LOG_PRINT("WARNING GameProgress Attempted to get next unread notif before loading SaveGame file");
         return -1;
     }
     else {
@@ -212,7 +212,7 @@ int32 GameProgress::GetNextNotif()
 bool32 GameProgress::CheckUnlock(uint8 id)
 {
     if (sceneInfo->inEditor || API::Storage::GetNoSave() || globals->saveLoaded != STATUS_OK) {
-        LogHelpers::Print("WARNING GameProgress Attempted to check unlock before loading SaveGame file");
+        LOG_PRINT("WARNING GameProgress Attempted to check unlock before loading SaveGame file");
         return false;
     }
     else {
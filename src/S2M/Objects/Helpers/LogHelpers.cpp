@@ -5,52 +5,381 @@
 // ---------------------------------------------------------------------
 
 #include "LogHelpers.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 using namespace RSDK;
 
+// Messages are queued by the game thread as a format pointer + raw args, formatted by a worker thread and then handed back to the game thread
+// to print, since the engine's print path isn't thread safe. The queue is single-producer (the game thread) & walked by three indices:
+// head (queued), formatted (done by the worker) and tail (printed), so the frame only ever pays for copying the args in & printing text out
+#define LOG_QUEUE_SIZE (0x100) // must be a power of 2
+
 namespace GameLogic
 {
 RSDK_REGISTER_OBJECT(LogHelpers);
 
+#if S2M_LOG_LEVEL >= LOGLEVEL_NORMAL
+static LogHelpers::LogEntry logQueue[LOG_QUEUE_SIZE];
+static std::atomic<uint32> logQueueHead(0);
+static std::atomic<uint32> logQueueFormatted(0);
+static uint32 logQueueTail = 0;
+
+static std::mutex logWorkerLock;
+static std::condition_variable logWorkerSignal;
+static std::atomic<bool32> logWorkerSleeping(false);
+static std::atomic<bool32> logWorkerRunning(false);
+static std::thread logWorker;
+
+static void FormatLogEntry(LogHelpers::LogEntry *entry, char *buffer, int32 bufferSize)
+{
+    const char *format = entry->format;
+    int32 pos          = 0;
+    int32 argID        = 0;
+
+    while (*format && pos < bufferSize - 1) {
+        if (*format != '%') {
+            buffer[pos++] = *format++;
+            continue;
+        }
+
+        if (format[1] == '%') {
+            buffer[pos++] = '%';
+            format += 2;
+            continue;
+        }
+
+        // copy the spec (minus any length modifiers, they're re-added below based on the stored type)
+        char spec[0x20];
+        int32 specLen   = 0;
+        spec[specLen++] = *format++;
+        while (*format && !strchr("diuoxXcfFeEgGaAsp", *format)) {
+            if (!strchr("hlLzjt", *format) && specLen < (int32)sizeof(spec) - 4)
+                spec[specLen++] = *format;
+            format++;
+        }
+
+        if (!*format || argID >= entry->argCount)
+            break;
+
+        LogHelpers::LogArg *arg = &entry->args[argID];
+        if (entry->argTypes[argID] == LogHelpers::LOGARG_INT64) {
+            spec[specLen++] = 'l';
+            spec[specLen++] = 'l';
+        }
+        spec[specLen++] = *format++;
+        spec[specLen]   = 0;
+
+        int32 written = 0;
+        switch (entry->argTypes[argID++]) {
+            default:
+            case LogHelpers::LOGARG_INT: written = snprintf(&buffer[pos], bufferSize - pos, spec, arg->i); break;
+            case LogHelpers::LOGARG_INT64: written = snprintf(&buffer[pos], bufferSize - pos, spec, (long long)arg->i64); break;
+            case LogHelpers::LOGARG_DOUBLE: written = snprintf(&buffer[pos], bufferSize - pos, spec, arg->f); break;
+            case LogHelpers::LOGARG_PTR: written = snprintf(&buffer[pos], bufferSize - pos, spec, arg->ptr); break;
+            case LogHelpers::LOGARG_STRING: written = snprintf(&buffer[pos], bufferSize - pos, spec, &entry->strings[arg->strOffset]); break;
+        }
+
+        if (written > 0)
+            pos = MIN(pos + written, bufferSize - 1);
+    }
+
+    buffer[pos] = 0;
+}
+
+static void LogWorker()
+{
+    while (true) {
+        uint32 formatted = logQueueFormatted.load(std::memory_order_relaxed);
+
+        if (formatted == logQueueHead.load()) {
+            std::unique_lock<std::mutex> lock(logWorkerLock);
+            logWorkerSleeping.store(true);
+            // checked again after flagging that we're asleep, QueueSubmit either sees the flag or we see its entry
+            while (formatted == logQueueHead.load() && logWorkerRunning.load()) logWorkerSignal.wait(lock);
+            logWorkerSleeping.store(false);
+
+            if (formatted == logQueueHead.load())
+                break;
+            continue;
+        }
+
+        LogHelpers::LogEntry *entry = &logQueue[formatted & (LOG_QUEUE_SIZE - 1)];
+        if (entry->type == LogHelpers::LOGENTRY_FORMAT)
+            FormatLogEntry(entry, entry->output, sizeof(entry->output));
+
+        logQueueFormatted.store(formatted + 1, std::memory_order_release);
+    }
+}
+
+static void WakeLogWorker()
+{
+    if (logWorkerSleeping.load()) {
+        std::lock_guard<std::mutex> lock(logWorkerLock);
+        logWorkerSignal.notify_one();
+    }
+}
+
+// last resort for when nothing called Shutdown, the worker's still joined rather than left running while the module goes away.
+// nothing is printed from here since the engine may already be gone, anything still queued at that point is dropped
+static struct LogWorkerShutdown {
+    ~LogWorkerShutdown()
+    {
+        if (logWorker.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(logWorkerLock);
+                logWorkerRunning.store(false);
+            }
+            logWorkerSignal.notify_one();
+            logWorker.join();
+        }
+    }
+} logWorkerShutdown;
+
+void LogHelpers::Pump()
+{
+    uint32 formatted = logQueueFormatted.load(std::memory_order_acquire);
+
+    for (; logQueueTail != formatted; ++logQueueTail) {
+        LogEntry *entry = &logQueue[logQueueTail & (LOG_QUEUE_SIZE - 1)];
+        switch (entry->type) {
+            default:
+            case LOGENTRY_FORMAT: Dev::Print(Dev::PRINT_NORMAL, entry->output); break;
+            case LOGENTRY_TEXT: Dev::Print(Dev::PRINT_NORMAL, entry->strings); break;
+            case LOGENTRY_INT32: Dev::Print(Dev::PRINT_NORMAL, entry->strings, entry->args[0].i); break;
+            case LOGENTRY_VECTOR2: Dev::Print(Dev::PRINT_NORMAL, entry->strings, &entry->vector); break;
+        }
+    }
+}
+
+static LogHelpers::LogEntry *ClaimLogEntry()
+{
+    if (!logWorkerRunning.load(std::memory_order_relaxed)) {
+        logWorkerRunning.store(true);
+        logWorker = std::thread(LogWorker);
+    }
+
+    // anything already formatted gets printed now, which also frees up its slot
+    LogHelpers::Pump();
+
+    // only waits if a full queue's worth of messages is still waiting on the worker
+    uint32 head = logQueueHead.load(std::memory_order_relaxed);
+    while (head - logQueueTail >= LOG_QUEUE_SIZE) {
+        std::this_thread::yield();
+        LogHelpers::Pump();
+    }
+
+    return &logQueue[head & (LOG_QUEUE_SIZE - 1)];
+}
+
+static void SubmitLogEntry()
+{
+    logQueueHead.store(logQueueHead.load(std::memory_order_relaxed) + 1);
+    WakeLogWorker();
+}
+
+static void CopyLogText(LogHelpers::LogEntry *entry, const char *text)
+{
+    strncpy(entry->strings, text ? text : "(null)", sizeof(entry->strings) - 1);
+    entry->strings[sizeof(entry->strings) - 1] = 0;
+}
+
+static void QueueLog(const char *message, va_list args)
+{
+    LogHelpers::LogEntry *entry = ClaimLogEntry();
+    entry->type                 = LogHelpers::LOGENTRY_FORMAT;
+    entry->format               = message;
+    entry->argCount             = 0;
+
+    uint16 stringPos = 0;
+    bool32 deferred  = true;
+    va_list argsCopy;
+    va_copy(argsCopy, args);
+
+    for (const char *format = message; *format && deferred; ++format) {
+        if (*format != '%')
+            continue;
+
+        if (*++format == '%')
+            continue;
+
+        int32 longCount = 0;
+        while (*format && !strchr("diuoxXcfFeEgGaAsp", *format)) {
+            switch (*format) {
+                case 'l': ++longCount; break;
+                case 'z':
+                case 'j':
+                case 't': longCount = 2; break;
+                case 'L':
+                case '*': deferred = false; break; // not worth storing, just format it here
+                default: break;
+            }
+            format++;
+        }
+
+        if (!*format || entry->argCount >= (int32)sizeof(entry->argTypes)) {
+            deferred = false;
+            break;
+        }
+
+        LogHelpers::LogArg *arg = &entry->args[entry->argCount];
+        uint8 *type             = &entry->argTypes[entry->argCount++];
+        switch (*format) {
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A':
+                *type  = LogHelpers::LOGARG_DOUBLE;
+                arg->f = va_arg(argsCopy, double);
+                break;
+
+            case 'p':
+                *type    = LogHelpers::LOGARG_PTR;
+                arg->ptr = va_arg(argsCopy, void *);
+                break;
+
+            case 's': {
+                // strings are copied since they're often temp buffers
+                const char *string = va_arg(argsCopy, const char *);
+                if (!string)
+                    string = "(null)";
+
+                *type          = LogHelpers::LOGARG_STRING;
+                arg->strOffset = stringPos;
+
+                while (*string && stringPos < sizeof(entry->strings) - 1) entry->strings[stringPos++] = *string++;
+                entry->strings[stringPos] = 0;
+                if (stringPos < sizeof(entry->strings) - 1)
+                    stringPos++;
+                break;
+            }
+
+            default:
+                if (longCount >= 2) {
+                    *type    = LogHelpers::LOGARG_INT64;
+                    arg->i64 = va_arg(argsCopy, long long);
+                }
+                else if (longCount == 1) {
+                    *type    = LogHelpers::LOGARG_INT64;
+                    arg->i64 = va_arg(argsCopy, long);
+                }
+                else {
+                    *type  = LogHelpers::LOGARG_INT;
+                    arg->i = va_arg(argsCopy, int32);
+                }
+                break;
+        }
+    }
+    va_end(argsCopy);
+
+    if (!deferred) {
+        // something the queue can't represent, format it up front and queue the result as plain text
+        vsnprintf(entry->strings, sizeof(entry->strings), message, args);
+        entry->type = LogHelpers::LOGENTRY_TEXT;
+    }
+
+    SubmitLogEntry();
+}
+
 void LogHelpers::PrintText(const char *message)
 {
-    if (!sceneInfo->inEditor)
-        Dev::Print(Dev::PRINT_NORMAL, message);
+    if (!sceneInfo->inEditor) {
+        // copied, the caller's buffer may be gone by the time this is printed
+        LogEntry *entry = ClaimLogEntry();
+        entry->type     = LOGENTRY_TEXT;
+        CopyLogText(entry, message);
+        SubmitLogEntry();
+    }
 }
 
 void LogHelpers::PrintString(String *message)
 {
-    if (!sceneInfo->inEditor)
-        Dev::PrintString(Dev::PRINT_NORMAL, message);
+    if (!sceneInfo->inEditor) {
+        LogEntry *entry = ClaimLogEntry();
+        entry->type     = LOGENTRY_TEXT;
+
+        int32 length = MIN(message->length, (int32)sizeof(entry->strings) - 1);
+        for (int32 c = 0; c < length; ++c) entry->strings[c] = (char)message->chars[c];
+        entry->strings[length] = 0;
+        SubmitLogEntry();
+    }
 }
 
 void LogHelpers::PrintInt32(const char *message, int32 value)
 {
-    if (!sceneInfo->inEditor)
-        Dev::Print(Dev::PRINT_NORMAL, message, value);
+    if (!sceneInfo->inEditor) {
+        LogEntry *entry  = ClaimLogEntry();
+        entry->type      = LOGENTRY_INT32;
+        entry->args[0].i = value;
+        CopyLogText(entry, message);
+        SubmitLogEntry();
+    }
 }
 void LogHelpers::Print(const char *message, ...)
 {
     if (!sceneInfo->inEditor) {
-        char messageText[0x100];
-
         va_list args;
         va_start(args, message);
-        vsprintf(messageText, message, args);
-
-        Dev::Print(Dev::PRINT_NORMAL, messageText);
-
+        QueueLog(message, args);
         va_end(args);
     }
 }
 void LogHelpers::PrintVector2(const char *message, RSDK::Vector2 value)
 {
-    if (!sceneInfo->inEditor)
-        Dev::Print(Dev::PRINT_NORMAL, message, &value);
+    if (!sceneInfo->inEditor) {
+        LogEntry *entry = ClaimLogEntry();
+        entry->type     = LOGENTRY_VECTOR2;
+        entry->vector   = value;
+        CopyLogText(entry, message);
+        SubmitLogEntry();
+    }
+}
+
+void LogHelpers::Flush()
+{
+    if (logWorkerRunning.load(std::memory_order_relaxed)) {
+        while (logQueueTail != logQueueHead.load(std::memory_order_relaxed)) {
+            std::this_thread::yield();
+            Pump();
+        }
+    }
+}
+
+void LogHelpers::Shutdown()
+{
+    if (!logWorker.joinable())
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(logWorkerLock);
+        logWorkerRunning.store(false);
+    }
+    logWorkerSignal.notify_one();
+
+    // the worker drains the queue before it exits, so everything queued so far still gets printed
+    logWorker.join();
+    Pump();
+}
+#endif
+
+// the worker's output is printed from here each frame, on top of whenever something new is logged
+void LogHelpers::StaticUpdate() { LogHelpers::Pump(); }
+
+void LogHelpers::StageLoad()
+{
+#if S2M_LOG_LEVEL >= LOGLEVEL_NORMAL
+    sVars->active = ACTIVE_ALWAYS;
+#endif
 }
 
 #if RETRO_REV0U
 void LogHelpers::StaticLoad(Static *sVars) { RSDK_INIT_STATIC_VARS(LogHelpers); }
 #endif
 
-} // namespace GameLogic
\ No newline at end of file
+} // namespace GameLogic
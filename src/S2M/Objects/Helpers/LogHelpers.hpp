@@ -1,6 +1,15 @@
 #pragma once
 #include "S2M.hpp"
 
+// Compile-time log filtering, call sites go through the LOG_* macros below so anything above S2M_LOG_LEVEL compiles away along with its arguments
+#define LOGLEVEL_NONE    (0)
+#define LOGLEVEL_NORMAL  (1)
+#define LOGLEVEL_VERBOSE (2)
+
+#ifndef S2M_LOG_LEVEL
+#define S2M_LOG_LEVEL LOGLEVEL_VERBOSE
+#endif
+
 namespace GameLogic
 {
 
@@ -14,6 +23,41 @@ struct LogHelpers : RSDK::GameObject::Entity {
     // STRUCTS
     // ==============================
 
+    enum LogEntryTypes : uint8 {
+        LOGENTRY_FORMAT,  // format + raw args, formatted by the worker
+        LOGENTRY_TEXT,    // already plain text, printed as-is
+        LOGENTRY_INT32,   // printed through the engine's int printer
+        LOGENTRY_VECTOR2, // printed through the engine's vector printer
+    };
+
+    enum LogArgTypes : uint8 {
+        LOGARG_INT,
+        LOGARG_INT64,
+        LOGARG_DOUBLE,
+        LOGARG_PTR,
+        LOGARG_STRING,
+    };
+
+    union LogArg {
+        int32 i;
+        int64 i64;
+        double f;
+        const void *ptr;
+        uint16 strOffset;
+    };
+
+    // a single queued message, the format pointer doubles as the format ID so it must have static storage (string literals, const tables)
+    struct LogEntry {
+        const char *format;
+        uint8 type;
+        uint8 argCount;
+        uint8 argTypes[8];
+        LogArg args[8];
+        RSDK::Vector2 vector;
+        char strings[0x100];
+        char output[0x100];
+    };
+
     // ==============================
     // STATIC VARS
     // ==============================
@@ -29,6 +73,8 @@ struct LogHelpers : RSDK::GameObject::Entity {
     // EVENTS
     // ==============================
 
+    static void StaticUpdate();
+    static void StageLoad();
 #if RETRO_REV0U
     static void StaticLoad(Static *sVars);
 #endif
@@ -36,16 +82,52 @@ struct LogHelpers : RSDK::GameObject::Entity {
     // ==============================
     // FUNCTIONS
     // ==============================
+#if S2M_LOG_LEVEL >= LOGLEVEL_NORMAL
     static void PrintText(const char *message);
     static void PrintString(RSDK::String *message);
     static void PrintInt32(const char *message, int32 value);
     static void Print(const char *message, ...);
     static void PrintVector2(const char *message, RSDK::Vector2 value);
 
+    // prints whatever the worker has finished formatting, this has to happen on the game thread since the engine's print isn't thread safe
+    static void Pump();
+    // blocks until every queued message has been formatted & printed
+    static void Flush();
+    // stops & joins the worker once everything queued has been printed, the next message starts it up again
+    static void Shutdown();
+#else
+    static inline void Pump() {}
+    static inline void Flush() {}
+    static inline void Shutdown() {}
+#endif
+
     // ==============================
     // DECLARATION
     // ==============================
 
     RSDK_DECLARE(LogHelpers);
 };
-} // namespace GameLogic
\ No newline at end of file
+} // namespace GameLogic
+
+#if S2M_LOG_LEVEL >= LOGLEVEL_NORMAL
+#define LOG_PRINT(...)                    GameLogic::LogHelpers::Print(__VA_ARGS__)
+#define LOG_PRINT_TEXT(message)           GameLogic::LogHelpers::PrintText(message)
+#define LOG_PRINT_STRING(message)         GameLogic::LogHelpers::PrintString(message)
+#define LOG_PRINT_INT32(message, value)   GameLogic::LogHelpers::PrintInt32(message, value)
+#define LOG_PRINT_VECTOR2(message, value) GameLogic::LogHelpers::PrintVector2(message, value)
+#else
+#define LOG_PRINT(...)
+#define LOG_PRINT_TEXT(message)
+#define LOG_PRINT_STRING(message)
+#define LOG_PRINT_INT32(message, value)
+#define LOG_PRINT_VECTOR2(message, value)
+#endif
+
+// for logs that can fire every frame (probes, wrap events, etc)
+#if S2M_LOG_LEVEL >= LOGLEVEL_VERBOSE
+#define LOG_PRINT_VERBOSE(...)            GameLogic::LogHelpers::Print(__VA_ARGS__)
+#define LOG_PRINT_TEXT_VERBOSE(message)   GameLogic::LogHelpers::PrintText(message)
+#else
+#define LOG_PRINT_VERBOSE(...)
+#define LOG_PRINT_TEXT_VERBOSE(message)
+#endif
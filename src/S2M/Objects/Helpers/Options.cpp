@@ -52,16 +52,16 @@ void Options::Reload()
 
     GetWinSize();
 
-    LogHelpers::Print("optionsPtr->screenShader = %d", options->screenShader);
-    LogHelpers::Print("optionsPtr->volMusic = %d", options->volMusic);
-    LogHelpers::Print("optionsPtr->volSfx = %d", options->volSfx);
-    LogHelpers::Print("optionsPtr->language = %d", options->language);
-    LogHelpers::Print("optionsPtr->overrideLanguage = %d", options->overrideLanguage);
-    LogHelpers::Print("optionsPtr->vsync = %d", options->vSync);
-    LogHelpers::Print("optionsPtr->tripleBuffering = %d", options->tripleBuffering);
-    LogHelpers::Print("optionsPtr->windowBorder = %d", options->windowBorder);
-    LogHelpers::Print("optionsPtr->windowed = %d", options->windowed);
-    LogHelpers::Print("optionsPtr->windowSize = %d", options->windowSize);
+    LOG_PRINT("optionsPtr->screenShader = %d", options->screenShader);
+    LOG_PRINT("optionsPtr->volMusic = %d", options->volMusic);
+    LOG_PRINT("optionsPtr->volSfx = %d", options->volSfx);
+    LOG_PRINT("optionsPtr->language = %d", options->language);
+    LOG_PRINT("optionsPtr->overrideLanguage = %d", options->overrideLanguage);
+    LOG_PRINT("optionsPtr->vsync = %d", options->vSync);
+    LOG_PRINT("optionsPtr->tripleBuffering = %d", options->tripleBuffering);
+    LOG_PRINT("optionsPtr->windowBorder = %d", options->windowBorder);
+    LOG_PRINT("optionsPtr->windowed = %d", options->windowed);
+    LOG_PRINT("optionsPtr->windowSize = %d", options->windowSize);
 }
 
 void Options::GetWinSize()
@@ -187,8 +187,8 @@ void Options::LoadOptionsCallback(int32 status)
         success                = true;
         globals->optionsLoaded = STATUS_OK;
 
-        LogHelpers::Print("dataPtr.language = %d", options->language);
-        LogHelpers::Print("dataPtr.overrideLanguage = %d", options->overrideLanguage);
+        LOG_PRINT("dataPtr.language = %d", options->language);
+        LOG_PRINT("dataPtr.overrideLanguage = %d", options->overrideLanguage);
         Options::LoadValuesFromSettings(GetOptionsRAM());
 
         Graphics::SetVideoSetting(VIDEOSETTING_SHADERID, options->screenShader);
@@ -77,33 +77,33 @@ void PlayerProbe::StageLoad() { sVars->aniFrames.Load("Global/PlaneSwitch.bin",
 void PlayerProbe::Print(Player *player)
 {
     if (!sceneInfo->inEditor) {
-        LogHelpers::Print("====================");
-        LogHelpers::Print("= Begin Probe      =");
-        LogHelpers::Print("====================");
+        LOG_PRINT_VERBOSE("====================");
+        LOG_PRINT_VERBOSE("= Begin Probe      =");
+        LOG_PRINT_VERBOSE("====================");
 
         if (this->direction)
-            LogHelpers::Print("direction = S/U");
+            LOG_PRINT_VERBOSE("direction = S/U");
         else
-            LogHelpers::Print("direction = U/S");
+            LOG_PRINT_VERBOSE("direction = U/S");
 
-        LogHelpers::Print("angle = %i", this->angle);
-        LogHelpers::Print("Cos256(angle) = %i", Math::Cos256(this->angle));
-        LogHelpers::Print("Sin256(angle) = %i", Math::Sin256(this->angle));
-        LogHelpers::Print("====================");
+        LOG_PRINT_VERBOSE("angle = %i", this->angle);
+        LOG_PRINT_VERBOSE("Cos256(angle) = %i", Math::Cos256(this->angle));
+        LOG_PRINT_VERBOSE("Sin256(angle) = %i", Math::Sin256(this->angle));
+        LOG_PRINT_VERBOSE("====================");
 
         if (player->direction)
-            LogHelpers::Print("direction = FACING_LEFT");
+            LOG_PRINT_VERBOSE("direction = FACING_LEFT");
         else
-            LogHelpers::Print("direction = FACING_RIGHT");
+            LOG_PRINT_VERBOSE("direction = FACING_RIGHT");
 
-        LogHelpers::Print("playerPtr->groundVel = %i", player->groundVel);
-        LogHelpers::Print("playerPtr->angle = %i", player->angle);
-        LogHelpers::Print("playerPtr->collisionMode = %i", player->collisionMode);
-        LogHelpers::Print("playerPtr->onGround = %i", player->onGround);
+        LOG_PRINT_VERBOSE("playerPtr->groundVel = %i", player->groundVel);
+        LOG_PRINT_VERBOSE("playerPtr->angle = %i", player->angle);
+        LOG_PRINT_VERBOSE("playerPtr->collisionMode = %i", player->collisionMode);
+        LOG_PRINT_VERBOSE("playerPtr->onGround = %i", player->onGround);
 
-        LogHelpers::Print("====================");
-        LogHelpers::Print("= End Probe        =");
-        LogHelpers::Print("====================");
+        LOG_PRINT_VERBOSE("====================");
+        LOG_PRINT_VERBOSE("= End Probe        =");
+        LOG_PRINT_VERBOSE("====================");
     }
 }
 
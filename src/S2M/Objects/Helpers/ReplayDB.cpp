@@ -45,7 +45,7 @@ void ReplayDB::LoadDB(void (*callback)(bool32 success))
             callback(false);
     }
     else {
-        LogHelpers::Print("Loading Replay DB");
+        LOG_PRINT("Loading Replay DB");
         globals->replayTableLoaded = STATUS_CONTINUE;
 
         sVars->loadEntity      = (Entity *)sceneInfo->entity;
@@ -53,7 +53,7 @@ void ReplayDB::LoadDB(void (*callback)(bool32 success))
         globals->replayTableID = APITable->LoadUserDB("ReplayDB.bin", ReplayDB::LoadDBCallback);
 
         if (globals->replayTableID == -1) {
-            LogHelpers::Print("Couldn't claim a slot for loading %s", "ReplayDB.bin");
+            LOG_PRINT("Couldn't claim a slot for loading %s", "ReplayDB.bin");
             globals->replayTableLoaded = STATUS_ERROR;
         }
     }
@@ -66,7 +66,7 @@ void ReplayDB::SaveDB(void (*callback)(bool32 success))
             callback(false);
     }
     else {
-        LogHelpers::Print("Saving Replay DB");
+        LOG_PRINT("Saving Replay DB");
         sVars->saveEntity   = (Entity *)sceneInfo->entity;
         sVars->saveCallback = callback;
         APITable->SaveUserDB(globals->replayTableID, ReplayDB::SaveDBCallback);
@@ -90,10 +90,10 @@ uint32 ReplayDB::AddReplay(uint8 zoneID, uint8 act, uint8 characterID, int32 sco
         sprintf_s(createTime, (int32)sizeof(createTime), "");
         APITable->GetUserDBRowCreationTime(globals->replayTableID, rowID, createTime, sizeof(createTime) - 1, "%Y/%m/%d %H:%M:%S");
 
-        LogHelpers::Print("Replay DB Added Entry");
-        LogHelpers::Print("Created at %s", createTime);
-        LogHelpers::Print("Row ID: %d", rowID);
-        LogHelpers::Print("UUID: %08X", UUID);
+        LOG_PRINT("Replay DB Added Entry");
+        LOG_PRINT("Created at %s", createTime);
+        LOG_PRINT("Row ID: %d", rowID);
+        LOG_PRINT("UUID: %08X", UUID);
 
         return rowID;
     }
@@ -117,7 +117,7 @@ void ReplayDB::DeleteReplay(int32 row, void (*callback)(bool32 success), bool32
     int32 count = APITable->GetSortedUserDBRowCount(globals->taTableID);
     for (int32 i = 0; i < count; ++i) {
         uint32 uuid = APITable->GetSortedUserDBRowID(globals->taTableID, i);
-        LogHelpers::Print("Deleting Time Attack replay from row #%d", uuid);
+        LOG_PRINT("Deleting Time Attack replay from row #%d", uuid);
         APITable->SetUserDBValue(globals->taTableID, uuid, API::Storage::UserDB::UInt32, "replayID", &replayID);
     }
 
@@ -131,21 +131,21 @@ void ReplayDB::DeleteReplay(int32 row, void (*callback)(bool32 success), bool32
 
 void ReplayDB::DeleteReplay_CB(int32 status)
 {
-    LogHelpers::Print("DeleteReplay_CB(%d)", status);
+    LOG_PRINT("DeleteReplay_CB(%d)", status);
 
     APITable->SaveUserDB(globals->replayTableID, ReplayDB::DeleteReplaySave_CB);
 }
 
 void ReplayDB::DeleteReplaySave_CB(int32 status)
 {
-    LogHelpers::Print("DeleteReplaySave_CB(%d)", status);
+    LOG_PRINT("DeleteReplaySave_CB(%d)", status);
 
     APITable->SaveUserDB(globals->taTableID, ReplayDB::DeleteReplaySave2_CB);
 }
 
 void ReplayDB::DeleteReplaySave2_CB(int32 status)
 {
-    LogHelpers::Print("DeleteReplaySave2_CB(%d)", status);
+    LOG_PRINT("DeleteReplaySave2_CB(%d)", status);
 
     if (sVars->deleteCallback) {
         Entity *store = (Entity *)sceneInfo->entity;
@@ -164,14 +164,14 @@ void ReplayDB::LoadDBCallback(int32 status)
     if (status == STATUS_OK) {
         globals->replayTableLoaded = STATUS_OK;
         APITable->SetupUserDBRowSorting(globals->replayTableID);
-        LogHelpers::Print("Load Succeeded! Replay count: %d", APITable->GetSortedUserDBRowCount(globals->replayTableID));
+        LOG_PRINT("Load Succeeded! Replay count: %d", APITable->GetSortedUserDBRowCount(globals->replayTableID));
     }
     else {
-        LogHelpers::Print("Load Failed! Creating new Replay DB");
+        LOG_PRINT("Load Failed! Creating new Replay DB");
         ReplayDB::CreateDB();
     }
 
-    LogHelpers::Print("Replay DB Slot => %d, Load Status => %d", globals->replayTableID, globals->replayTableLoaded);
+    LOG_PRINT("Replay DB Slot => %d, Load Status => %d", globals->replayTableID, globals->replayTableLoaded);
 
     if (sVars->loadCallback) {
         Entity *store = (Entity *)sceneInfo->entity;
@@ -0,0 +1,228 @@
+// ---------------------------------------------------------------------
+// RSDK Project: Sonic 2 Mania
+// Object Description: SolidIndex Object
+// Object Author: Ducky
+// ---------------------------------------------------------------------
+
+#include "SolidIndex.hpp"
+#include "Global/PlaneSwitch.hpp"
+#include "Global/Spikes.hpp"
+#include "Common/BreakableWall.hpp"
+#include "Helpers/LogHelpers.hpp"
+
+using namespace RSDK;
+
+// Solids are kept in a single list sorted by their left edge. Zone marks it stale every frame & the first query after that refreshes it, which
+// is close to a no-op insertion sort since most solids barely move, and a query only has to walk the entries between (left - widest solid) and
+// right. Stages that never query never pay for the refresh.
+// Platforms aren't indexed, they can be moved or snapped back to their start (RollerMKII's reset) between refreshes by far more than the
+// margin covers, so anything colliding with them still walks the platform list itself
+// This lives outside of sVars so it works in any stage, whether or not SolidIndex itself is loaded there
+
+namespace GameLogic
+{
+RSDK_REGISTER_OBJECT(SolidIndex);
+
+static SolidIndex::SolidEntry solidList[SOLIDINDEX_COUNT];
+static int32 solidCount    = 0;
+static int32 solidMaxWidth = 0;
+static bool32 solidsStale  = false;
+static uint8 solidSlotMask[ENTITY_COUNT];
+
+static bool32 UpdateSolidBounds(SolidIndex::SolidEntry *entry)
+{
+    GameObject::Entity *entity = GameObject::Get(entry->slot);
+    if (entity->classID != entry->classID)
+        return false;
+
+    int32 x       = entity->position.x;
+    int32 y       = entity->position.y;
+    int32 extentX = 0;
+    int32 extentY = 0;
+
+    switch (entry->type) {
+        default: break;
+
+        case SolidIndex::SolidPlaneSwitch: {
+            // rotated 0x18 x (size * 8) box, so bound it by its radius on both axes
+            PlaneSwitch *planeSwitch = (PlaneSwitch *)entity;
+            extentX                  = 0x180000 + (planeSwitch->size << 19);
+            extentY                  = extentX;
+            break;
+        }
+
+        case SolidIndex::SolidSpikes: {
+            Spikes *spikes = (Spikes *)entity;
+            extentX        = MAX(abs(spikes->hitbox.left), abs(spikes->hitbox.right)) << 16;
+            extentY        = MAX(abs(spikes->hitbox.top), abs(spikes->hitbox.bottom)) << 16;
+            break;
+        }
+
+        case SolidIndex::SolidBreakableWall: {
+            BreakableWall *wall = (BreakableWall *)entity;
+            extentX             = MAX(abs(wall->hitbox.left), abs(wall->hitbox.right)) << 16;
+            extentY             = MAX(abs(wall->hitbox.top), abs(wall->hitbox.bottom)) << 16;
+            break;
+        }
+    }
+
+    extentX += SOLIDINDEX_MARGIN;
+    extentY += SOLIDINDEX_MARGIN;
+
+    entry->left   = x - extentX;
+    entry->top    = y - extentY;
+    entry->right  = x + extentX;
+    entry->bottom = y + extentY;
+    return true;
+}
+
+void SolidIndex::Reset()
+{
+    solidCount    = 0;
+    solidMaxWidth = 0;
+    solidsStale   = false;
+    memset(solidSlotMask, 0, sizeof(solidSlotMask));
+}
+
+void SolidIndex::Register(RSDK::GameObject::Entity *entity, uint8 type)
+{
+    uint16 slot = entity->Slot();
+
+    // the slot is still listed from an older solid of the same type that was never pruned, so drop that entry before adding this one
+    if (solidSlotMask[slot] & (1 << type)) {
+        for (int32 i = 0; i < solidCount; ++i) {
+            if (solidList[i].slot == slot && solidList[i].type == type) {
+                memmove(&solidList[i], &solidList[i + 1], (solidCount - i - 1) * sizeof(SolidEntry));
+                solidCount--;
+                break;
+            }
+        }
+    }
+    else if (solidCount >= SOLIDINDEX_COUNT) {
+        return;
+    }
+
+    SolidEntry entry;
+    entry.slot    = slot;
+    entry.classID = entity->classID;
+    entry.type    = type;
+    UpdateSolidBounds(&entry);
+
+    int32 lo = 0;
+    int32 hi = solidCount;
+    while (lo < hi) {
+        int32 mid = (lo + hi) >> 1;
+        if (solidList[mid].left <= entry.left)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    memmove(&solidList[lo + 1], &solidList[lo], (solidCount - lo) * sizeof(SolidEntry));
+    solidList[lo] = entry;
+    solidCount++;
+
+    solidSlotMask[slot] |= 1 << type;
+    solidMaxWidth = MAX(solidMaxWidth, entry.right - entry.left);
+}
+
+// entities restored with GameObject::Copy never run Create, so they have to be registered by whoever copied them
+void SolidIndex::RegisterCopy(RSDK::GameObject::Entity *entity)
+{
+    if (PlaneSwitch::sVars && entity->classID == PlaneSwitch::sVars->classID)
+        Register(entity, SolidPlaneSwitch);
+    else if (Spikes::sVars && entity->classID == Spikes::sVars->classID)
+        Register(entity, SolidSpikes);
+    else if (BreakableWall::sVars && entity->classID == BreakableWall::sVars->classID)
+        Register(entity, SolidBreakableWall);
+}
+
+// Zone::StaticUpdate calls this at the start of every frame. Static updates all run before any entity updates, so the first query of each
+// frame always refreshes from where the solids ended the previous one, and SOLIDINDEX_MARGIN only has to cover a single frame of movement
+// by whatever updates before that query. Anything that can move a solid further than that between queries has to be left out of the index
+void SolidIndex::MarkStale() { solidsStale = true; }
+
+void SolidIndex::Refresh()
+{
+    int32 count   = 0;
+    solidMaxWidth = 0;
+    solidsStale   = false;
+
+    for (int32 i = 0; i < solidCount; ++i) {
+        SolidEntry entry = solidList[i];
+
+        if (!UpdateSolidBounds(&entry)) {
+            solidSlotMask[entry.slot] &= ~(1 << entry.type);
+            continue;
+        }
+
+        // compact & re-sort in the same pass, this never writes past i
+        int32 e = count++;
+        for (; e > 0 && solidList[e - 1].left > entry.left; --e) solidList[e] = solidList[e - 1];
+        solidList[e] = entry;
+
+        solidMaxWidth = MAX(solidMaxWidth, entry.right - entry.left);
+    }
+
+    solidCount = count;
+}
+
+int32 SolidIndex::Query(int32 left, int32 top, int32 right, int32 bottom, uint8 typeMask, bool32 activeOnly, SolidHit *hits, int32 maxCount)
+{
+    if (solidsStale)
+        Refresh();
+
+    // nothing starting before this can reach left
+    int64 start = (int64)left - solidMaxWidth;
+
+    int32 lo = 0;
+    int32 hi = solidCount;
+    while (lo < hi) {
+        int32 mid = (lo + hi) >> 1;
+        if (solidList[mid].left < start)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    int32 count = 0;
+    for (int32 i = lo; i < solidCount && solidList[i].left <= right; ++i) {
+        SolidEntry *entry = &solidList[i];
+        if (!(typeMask & (1 << entry->type)) || entry->right < left || entry->bottom < top || entry->top > bottom)
+            continue;
+
+        GameObject::Entity *solid = GameObject::Get(entry->slot);
+        if (solid->classID != entry->classID || (activeOnly && !solid->inRange))
+            continue;
+
+        if (count >= maxCount) {
+            LOG_PRINT("SolidIndex::Query: more than %d solids in range, the rest were dropped", maxCount);
+            break;
+        }
+
+        // keep results grouped by type, then in slot order, the same order the per-class loops this replaces visited them in
+        uint32 key = (entry->type << 16) | entry->slot;
+        int32 h    = count++;
+        for (; h > 0 && (uint32)((hits[h - 1].type << 16) | hits[h - 1].entity->Slot()) > key; --h) hits[h] = hits[h - 1];
+        hits[h].entity = solid;
+        hits[h].type   = entry->type;
+    }
+
+    return count;
+}
+
+int32 SolidIndex::QueryHitbox(RSDK::GameObject::Entity *entity, RSDK::Hitbox *hitbox, uint8 typeMask, bool32 activeOnly, SolidHit *hits,
+                              int32 maxCount)
+{
+    int32 extentX = MAX(abs(hitbox->left), abs(hitbox->right)) << 16;
+    int32 extentY = MAX(abs(hitbox->top), abs(hitbox->bottom)) << 16;
+
+    return Query(entity->position.x - extentX, entity->position.y - extentY, entity->position.x + extentX, entity->position.y + extentY, typeMask,
+                 activeOnly, hits, maxCount);
+}
+
+#if RETRO_REV0U
+void SolidIndex::StaticLoad(Static *sVars) { RSDK_INIT_STATIC_VARS(SolidIndex); }
+#endif
+
+} // namespace GameLogic
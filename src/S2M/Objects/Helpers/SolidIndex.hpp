@@ -0,0 +1,84 @@
+#pragma once
+#include "S2M.hpp"
+
+#define SOLIDINDEX_COUNT       (ENTITY_COUNT)
+#define SOLIDINDEX_QUERY_COUNT (0x100)
+// solids are refreshed at most once per frame, so pad them by how far one could plausibly move before a later query in the same frame
+// (see SolidIndex::MarkStale for the ordering this relies on)
+#define SOLIDINDEX_MARGIN (0x400000)
+
+namespace GameLogic
+{
+
+struct SolidIndex : RSDK::GameObject::Entity {
+
+    // ==============================
+    // ENUMS
+    // ==============================
+
+    // query results come back grouped in this order
+    enum SolidTypes {
+        SolidPlaneSwitch,
+        SolidSpikes,
+        SolidBreakableWall,
+        SolidTypeCount,
+    };
+
+    // ==============================
+    // STRUCTS
+    // ==============================
+
+    struct SolidEntry {
+        int32 left;
+        int32 top;
+        int32 right;
+        int32 bottom;
+        uint16 slot;
+        uint16 classID;
+        uint8 type;
+    };
+
+    struct SolidHit {
+        RSDK::GameObject::Entity *entity;
+        uint8 type;
+    };
+
+    // ==============================
+    // STATIC VARS
+    // ==============================
+
+    struct Static : RSDK::GameObject::Static {
+    };
+
+    // ==============================
+    // INSTANCE VARS
+    // ==============================
+
+    // ==============================
+    // EVENTS
+    // ==============================
+
+#if RETRO_REV0U
+    static void StaticLoad(Static *sVars);
+#endif
+
+    // ==============================
+    // FUNCTIONS
+    // ==============================
+
+    static void Reset();
+    static void Register(RSDK::GameObject::Entity *entity, uint8 type);
+    static void RegisterCopy(RSDK::GameObject::Entity *entity);
+    static void MarkStale();
+    static void Refresh();
+    static int32 Query(int32 left, int32 top, int32 right, int32 bottom, uint8 typeMask, bool32 activeOnly, SolidHit *hits, int32 maxCount);
+    static int32 QueryHitbox(RSDK::GameObject::Entity *entity, RSDK::Hitbox *hitbox, uint8 typeMask, bool32 activeOnly, SolidHit *hits,
+                             int32 maxCount);
+
+    // ==============================
+    // DECLARATION
+    // ==============================
+
+    RSDK_DECLARE(SolidIndex);
+};
+} // namespace GameLogic
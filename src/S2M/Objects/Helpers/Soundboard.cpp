@@ -16,55 +16,83 @@ void Soundboard::Update() {}
 void Soundboard::LateUpdate() {}
 void Soundboard::StaticUpdate()
 {
+    bool32 canPlay = sceneInfo->state == ENGINESTATE_REGULAR;
+
+    // polled slots still ask their checkCallback every frame, the answer just holds or drops the slot's reference the same way AcquireLoop &
+    // ReleaseLoop would
     for (int32 s = 0; s < MIN(sVars->sfxCount, 32); ++s) {
-        bool32 shouldStopSfx = true;
-        SoundInfo info       = {};
+        if (!sVars->sfxCheckCallback[s])
+            continue;
 
-        if (sVars->sfxCheckCallback[s] && sceneInfo->state == ENGINESTATE_REGULAR) {
+        SoundInfo info = {};
+        if (canPlay)
             info = sVars->sfxCheckCallback[s]();
-            if (info.playFlags & PlayOnStart) {
-                shouldStopSfx             = false;
-                sVars->sfxFadeOutTimer[s] = 0;
-
-                if (!sVars->sfxIsPlaying[s]) {
-                    sVars->sfxChannel[s]      = info.sfx.Play(info.loopPoint);
-                    sVars->sfxIsPlaying[s]    = true;
-                    sVars->sfxPlayingTimer[s] = 0;
-                }
-
-                if (sVars->sfxFadeOutDuration[s] > 0)
-                    channels[sVars->sfxChannel[s]].SetAttributes(1.0, 0.0, 1.0);
 
-                if (sVars->sfxUpdateCallback[s]) {
-                    sVars->sfxUpdateCallback[s](s);
-                    ++sVars->sfxPlayingTimer[s];
-                }
+        if (info.playFlags & PlayOnStart) {
+            if (!sVars->sfxIsPlaying[s]) {
+                sVars->sfxList[s]      = info.sfx;
+                sVars->sfxLoopPoint[s] = info.loopPoint;
             }
+
+            sVars->sfxRefCount[s] = 1;
+            sVars->activeSfx |= 1 << s;
+        }
+        else {
+            sVars->sfxRefCount[s]    = 0;
+            sVars->sfxFinishFlags[s] = info.playFlags;
+            sVars->sfxFinishSfx[s]   = info.sfx;
         }
+    }
+
+    uint32 activeSfx = sVars->activeSfx;
+    for (int32 s = 0; activeSfx; ++s, activeSfx >>= 1) {
+        if (!(activeSfx & 1))
+            continue;
 
-        if (shouldStopSfx) {
-            if (sVars->sfxIsPlaying[s]) {
+        if (canPlay && sVars->sfxRefCount[s] > 0) {
+            if (!sVars->sfxIsPlaying[s]) {
+                sVars->sfxChannel[s]      = sVars->sfxList[s].Play(sVars->sfxLoopPoint[s]);
+                sVars->sfxIsPlaying[s]    = true;
+                sVars->sfxPlayingTimer[s] = 0;
                 sVars->sfxFadeOutTimer[s] = 0;
 
-                if (!sVars->sfxFadeOutDuration[s]) {
-                    if (info.playFlags & PlayOnFinish)
-                        info.sfx.Play();
-                    else
-                        sVars->sfxList[s].Stop();
-                }
+                // only needs restoring after a fade, it'll stay put until the next one
+                if (sVars->sfxFadeOutDuration[s] > 0)
+                    channels[sVars->sfxChannel[s]].SetAttributes(1.0, 0.0, 1.0);
+            }
 
-                sVars->sfxIsPlaying[s]    = false;
-                sVars->sfxPlayingTimer[s] = 0;
+            if (sVars->sfxUpdateCallback[s]) {
+                sVars->sfxUpdateCallback[s](s);
+                ++sVars->sfxPlayingTimer[s];
             }
-            else if (sVars->sfxFadeOutDuration[s] > 0 && sVars->sfxChannel[s] > 0) {
-                if (sVars->sfxFadeOutTimer[s] >= sVars->sfxFadeOutDuration[s]) {
+        }
+        else if (sVars->sfxIsPlaying[s]) {
+            sVars->sfxFadeOutTimer[s] = 0;
+
+            if (!sVars->sfxFadeOutDuration[s]) {
+                if (sVars->sfxFinishFlags[s] & PlayOnFinish)
+                    sVars->sfxFinishSfx[s].Play();
+                else
                     sVars->sfxList[s].Stop();
-                }
-                else {
-                    channels[sVars->sfxChannel[s]].SetAttributes(1.0f - (sVars->sfxFadeOutTimer[s] / (float)sVars->sfxFadeOutDuration[s]), 0.0, 1.0);
-                    ++sVars->sfxFadeOutTimer[s];
-                }
             }
+
+            sVars->sfxIsPlaying[s]    = false;
+            sVars->sfxPlayingTimer[s] = 0;
+
+            if (!sVars->sfxFadeOutDuration[s] && !sVars->sfxRefCount[s])
+                sVars->activeSfx &= ~(1 << s);
+        }
+        else if (sVars->sfxFadeOutDuration[s] > 0 && sVars->sfxChannel[s] > 0 && sVars->sfxFadeOutTimer[s] < sVars->sfxFadeOutDuration[s]) {
+            channels[sVars->sfxChannel[s]].SetAttributes(1.0f - (sVars->sfxFadeOutTimer[s] / (float)sVars->sfxFadeOutDuration[s]), 0.0, 1.0);
+            ++sVars->sfxFadeOutTimer[s];
+        }
+        else {
+            if (sVars->sfxFadeOutDuration[s] > 0 && sVars->sfxChannel[s] > 0)
+                sVars->sfxList[s].Stop();
+
+            // a slot that's still held stays listed so it can start back up once the game is unpaused
+            if (!sVars->sfxRefCount[s])
+                sVars->activeSfx &= ~(1 << s);
         }
     }
 }
@@ -79,13 +107,18 @@ void Soundboard::StageLoad()
 
     for (int32 i = 0; i < 32; ++i) {
         sVars->sfxList[i].Init();
+        sVars->sfxFinishSfx[i].Init();
         sVars->sfxLoopPoint[i]       = 0;
         sVars->sfxCheckCallback[i]   = nullptr;
         sVars->sfxUpdateCallback[i]  = nullptr;
         sVars->sfxIsPlaying[i]       = false;
         sVars->sfxPlayingTimer[i]    = 0;
         sVars->sfxFadeOutDuration[i] = 0;
+        sVars->sfxRefCount[i]        = 0;
+        sVars->sfxFinishFlags[i]     = PlayNever;
     }
+
+    sVars->activeSfx = 0;
 }
 
 uint8 Soundboard::LoadSfx(SoundInfo (*checkCallback)(), void (*updateCallback)(int32 sfxID))
@@ -100,6 +133,8 @@ uint8 Soundboard::LoadSfx(SoundInfo (*checkCallback)(), void (*updateCallback)(i
     sVars->sfxCheckCallback[sfxID]   = checkCallback;
     sVars->sfxUpdateCallback[sfxID]  = updateCallback;
     sVars->sfxFadeOutDuration[sfxID] = 0;
+    sVars->sfxRefCount[sfxID]        = 0;
+    sVars->sfxIsPlaying[sfxID]       = false;
     sVars->sfxList[sfxID].Stop();
 
     ++sVars->sfxCount;
@@ -120,12 +155,33 @@ uint8 Soundboard::LoadSfxName(const char *sfxName, uint32 loopPoint, SoundInfo (
     sVars->sfxCheckCallback[sfxID]   = checkCallback;
     sVars->sfxUpdateCallback[sfxID]  = updateCallback;
     sVars->sfxFadeOutDuration[sfxID] = 0;
+    sVars->sfxRefCount[sfxID]        = 0;
+    sVars->sfxIsPlaying[sfxID]       = false;
     sVars->sfxList[sfxID].Stop();
 
     ++sVars->sfxCount;
     return sfxID;
 }
 
+void Soundboard::AcquireLoop(uint8 sfxID)
+{
+    if (!sVars || sfxID >= MIN(sVars->sfxCount, 32) || sVars->sfxCheckCallback[sfxID])
+        return;
+
+    ++sVars->sfxRefCount[sfxID];
+    sVars->activeSfx |= 1 << sfxID;
+}
+
+void Soundboard::ReleaseLoop(uint8 sfxID)
+{
+    if (!sVars || sfxID >= MIN(sVars->sfxCount, 32) || sVars->sfxCheckCallback[sfxID])
+        return;
+
+    // StaticUpdate stops (or fades out) the sound once it sees the count hit 0
+    if (sVars->sfxRefCount[sfxID] > 0)
+        --sVars->sfxRefCount[sfxID];
+}
+
 #if RETRO_INCLUDE_EDITOR
 void Soundboard::EditorDraw() {}
 
@@ -137,7 +193,10 @@ void Soundboard::StaticLoad(Static *sVars)
 {
     RSDK_INIT_STATIC_VARS(Soundboard);
 
-    for (int32 s = 0; s < 32; ++s) sVars->sfxList[s].Init();
+    for (int32 s = 0; s < 32; ++s) {
+        sVars->sfxList[s].Init();
+        sVars->sfxFinishSfx[s].Init();
+    }
 }
 #endif
 
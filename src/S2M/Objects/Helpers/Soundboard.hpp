@@ -39,6 +39,10 @@ struct Soundboard : RSDK::GameObject::Entity {
         int32 sfxPlayingTimer[32];
         int32 sfxFadeOutTimer[32];
         int32 sfxFadeOutDuration[32];
+        int32 sfxRefCount[32];
+        uint16 sfxFinishFlags[32];
+        RSDK::SoundFX sfxFinishSfx[32]; // whatever the checkCallback returned alongside PlayOnFinish
+        uint32 activeSfx; // slots that are held, playing or fading out, nothing else gets touched each frame
     };
 
     // ==============================
@@ -73,6 +77,10 @@ struct Soundboard : RSDK::GameObject::Entity {
     static uint8 LoadSfx(SoundInfo (*checkCallback)(), void (*updateCallback)(int32 sfxID));
     static uint8 LoadSfxName(const char *sfxName, uint32 loopPoint, SoundInfo (*checkCallback)(), void (*updateCallback)(int32 sfxID)); // mania version of function
 
+    // slots loaded without a checkCallback play while at least one AcquireLoop is outstanding
+    static void AcquireLoop(uint8 sfxID);
+    static void ReleaseLoop(uint8 sfxID);
+
     // ==============================
     // DECLARATION
     // ==============================
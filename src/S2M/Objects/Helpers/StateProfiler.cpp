@@ -0,0 +1,313 @@
+// ---------------------------------------------------------------------
+// RSDK Project: Sonic 2 Mania
+// Object Description: StateProfiler Object
+// Object Author: Ducky
+// ---------------------------------------------------------------------
+
+#include "StateProfiler.hpp"
+
+#if S2M_PROFILE
+#include <chrono>
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <dbghelp.h>
+#pragma comment(lib, "dbghelp.lib")
+#else
+#include <dlfcn.h>
+#include <cxxabi.h>
+#endif
+#endif
+
+using namespace RSDK;
+
+// Totals live in a fixed open-addressed table and every timed call is also appended to a ring of the most recent events for the trace export.
+// Both are only ever written from the game thread, so recording is just a lookup, two adds & a store, with no locks or allocation.
+// Entry 0 is reserved for anything untracked, either state machines with no state set or anything past a full table
+// Open scopes are kept on a small stack so each one can hand its time up to its parent, which keeps every entry's cycles exclusive
+
+namespace GameLogic
+{
+RSDK_REGISTER_OBJECT(StateProfiler);
+
+#if S2M_PROFILE
+static StateProfiler::ProfileEntry profileEntries[PROFILER_ENTRY_COUNT];
+static StateProfiler::TraceEvent traceEvents[PROFILER_TRACE_COUNT];
+static uint32 traceCount = 0;
+static int32 exportID    = 0;
+
+static uint64 scopeChildCycles[PROFILER_SCOPE_DEPTH];
+static int32 scopeDepth = 0;
+
+static const char *profileTypeNames[] = { "event", "state", "function" };
+
+// used to convert cycles to microseconds for the trace, measured over the whole capture so nothing has to stall to calibrate it
+static uint64 captureStartCycles = 0;
+static std::chrono::steady_clock::time_point captureStartTime;
+
+static void SymbolizeState(uintptr_t key, char *buffer, int32 bufferSize)
+{
+#if defined(_WIN32)
+    static bool32 symbolsLoaded = false;
+    if (!symbolsLoaded) {
+        SymSetOptions(SYMOPT_UNDNAME | SYMOPT_DEFERRED_LOADS);
+        SymInitialize(GetCurrentProcess(), nullptr, TRUE);
+        symbolsLoaded = true;
+    }
+
+    uint8 symbolBuffer[sizeof(SYMBOL_INFO) + 0x100];
+    SYMBOL_INFO *symbol = (SYMBOL_INFO *)symbolBuffer;
+    memset(symbol, 0, sizeof(SYMBOL_INFO));
+    symbol->SizeOfStruct = sizeof(SYMBOL_INFO);
+    symbol->MaxNameLen   = 0x100;
+
+    if (SymFromAddr(GetCurrentProcess(), (DWORD64)key, nullptr, symbol)) {
+        snprintf(buffer, bufferSize, "%s", symbol->Name);
+        return;
+    }
+#else
+    Dl_info info;
+    if (dladdr((void *)key, &info) && info.dli_sname) {
+        int32 status    = 0;
+        char *demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+        snprintf(buffer, bufferSize, "%s", (status == 0 && demangled) ? demangled : info.dli_sname);
+        free(demangled);
+        return;
+    }
+#endif
+
+    snprintf(buffer, bufferSize, "0x%llx", (unsigned long long)key);
+}
+
+static void GetEntryName(StateProfiler::ProfileEntry *entry, char *buffer, int32 bufferSize)
+{
+    if (entry->name)
+        snprintf(buffer, bufferSize, "%s", entry->name);
+    else if (entry->key)
+        SymbolizeState(entry->key, buffer, bufferSize);
+    else
+        snprintf(buffer, bufferSize, "(untracked)");
+
+    // the CSV & JSON output don't quote anything, so keep the names plain
+    for (char *c = buffer; *c; ++c) {
+        if (*c == ',' || *c == '"' || *c == '\\')
+            *c = ' ';
+    }
+}
+
+// object names aren't available from the classID, so pull it out of one of the class's event names ("void GameLogic::Player::Update()")
+static void GetClassName(uint16 classID, char *buffer, int32 bufferSize)
+{
+    snprintf(buffer, bufferSize, "class %d", classID);
+
+    // base class events run nested inside the derived object's own, so only the outermost ones have the right name
+    for (int32 e = 1; e < PROFILER_ENTRY_COUNT; ++e) {
+        StateProfiler::ProfileEntry *entry = &profileEntries[e];
+        if (!entry->calls || !entry->outermost || entry->type != StateProfiler::ProfileEvent || entry->classID != classID)
+            continue;
+
+        const char *start = strstr(entry->name, "GameLogic::");
+        start             = start ? start + strlen("GameLogic::") : entry->name;
+        const char *end   = strstr(start, "::");
+        if (end)
+            snprintf(buffer, bufferSize, "%.*s", (int32)(end - start), start);
+        break;
+    }
+}
+
+static int32 CompareEntries(const void *a, const void *b)
+{
+    uint64 cyclesA = profileEntries[*(const uint16 *)a].cycles;
+    uint64 cyclesB = profileEntries[*(const uint16 *)b].cycles;
+    return cyclesA < cyclesB ? 1 : (cyclesA > cyclesB ? -1 : 0);
+}
+
+uint16 StateProfiler::GetEntry(uintptr_t key, uint16 classID, uint8 type, const char *name)
+{
+    if (!captureStartCycles)
+        Reset();
+
+    if (!key)
+        return 0;
+
+    uint32 hash = (uint32)((key >> 4) ^ (key >> 20) ^ (classID * 0x9E3779B1));
+
+    for (int32 i = 0; i < PROFILER_ENTRY_COUNT; ++i) {
+        uint16 entryID = (hash + i) & (PROFILER_ENTRY_COUNT - 1);
+        if (!entryID)
+            continue;
+
+        ProfileEntry *entry = &profileEntries[entryID];
+        if (entry->key == key && entry->classID == classID && entry->type == type)
+            return entryID;
+
+        if (!entry->key) {
+            entry->key     = key;
+            entry->name    = name;
+            entry->classID = classID;
+            entry->type    = type;
+            return entryID;
+        }
+    }
+
+    return 0;
+}
+
+void StateProfiler::Enter()
+{
+    // anything nested past the stack still gets timed, it just isn't taken out of its parent
+    if (scopeDepth < PROFILER_SCOPE_DEPTH)
+        scopeChildCycles[scopeDepth] = 0;
+    scopeDepth++;
+}
+
+void StateProfiler::Record(uint16 entryID, uint64 start, uint64 end)
+{
+    uint64 duration = end - start;
+
+    --scopeDepth;
+    uint64 childCycles = scopeDepth < PROFILER_SCOPE_DEPTH ? scopeChildCycles[scopeDepth] : 0;
+    if (scopeDepth > 0 && scopeDepth <= PROFILER_SCOPE_DEPTH)
+        scopeChildCycles[scopeDepth - 1] += duration;
+
+    ProfileEntry *entry = &profileEntries[entryID];
+    entry->calls++;
+    entry->cycles += duration - MIN(childCycles, duration);
+    if (!scopeDepth)
+        entry->outermost = true;
+
+    // the trace keeps the full duration, the viewer nests the events itself
+    TraceEvent *event = &traceEvents[traceCount++ & (PROFILER_TRACE_COUNT - 1)];
+    event->start      = start;
+    event->duration   = (uint32)MIN(duration, 0xFFFFFFFF);
+    event->entryID    = entryID;
+}
+
+// scopeDepth is left alone, Reset can run from inside an open scope via GetEntry
+void StateProfiler::Reset()
+{
+    memset(profileEntries, 0, sizeof(profileEntries));
+    traceCount = 0;
+
+    captureStartCycles = ReadCycles();
+    captureStartTime   = std::chrono::steady_clock::now();
+}
+
+void StateProfiler::Export()
+{
+    if (!traceCount) {
+        Reset();
+        return;
+    }
+
+    double elapsedMicro   = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - captureStartTime).count();
+    uint64 elapsedCycles  = ReadCycles() - captureStartCycles;
+    double cyclesPerMicro = elapsedMicro > 0.0 ? elapsedCycles / elapsedMicro : 1.0;
+
+    char fileName[0x40];
+    char name[0x200];
+    char className[0x80];
+
+    static uint16 sortedEntries[PROFILER_ENTRY_COUNT];
+    int32 entryCount = 0;
+    for (int32 e = 0; e < PROFILER_ENTRY_COUNT; ++e) {
+        if (profileEntries[e].calls)
+            sortedEntries[entryCount++] = e;
+    }
+    qsort(sortedEntries, entryCount, sizeof(uint16), CompareEntries);
+
+    sprintf_s(fileName, (int32)sizeof(fileName), "S2MProfile_%d.csv", exportID);
+    FILE *file = fopen(fileName, "w");
+    if (file) {
+        fprintf(file, "type,classID,class,name,calls,cycles,avgCycles\n");
+
+        // per class totals come first, every entry is exclusive so the class's cycles are just the sum of them all
+        // calls only count the outermost events though, otherwise a nested base class event would count the same update twice
+        static uint64 classCycles[0x10000];
+        static uint32 classCalls[0x10000];
+        memset(classCycles, 0, sizeof(classCycles));
+        memset(classCalls, 0, sizeof(classCalls));
+        for (int32 e = 0; e < entryCount; ++e) {
+            ProfileEntry *entry = &profileEntries[sortedEntries[e]];
+            if (!entry->key)
+                continue;
+
+            classCycles[entry->classID] += entry->cycles;
+            if (entry->type == ProfileEvent && entry->outermost)
+                classCalls[entry->classID] += entry->calls;
+        }
+
+        for (int32 e = 0; e < entryCount; ++e) {
+            ProfileEntry *entry = &profileEntries[sortedEntries[e]];
+            if (entry->type != ProfileEvent || !entry->key || !classCalls[entry->classID])
+                continue;
+
+            GetClassName(entry->classID, className, sizeof(className));
+            fprintf(file, "class,%d,%s,%s,%u,%llu,%llu\n", entry->classID, className, className, classCalls[entry->classID],
+                    (unsigned long long)classCycles[entry->classID], (unsigned long long)(classCycles[entry->classID] / classCalls[entry->classID]));
+            classCalls[entry->classID] = 0;
+        }
+
+        for (int32 e = 0; e < entryCount; ++e) {
+            ProfileEntry *entry = &profileEntries[sortedEntries[e]];
+            const char *type    = !entry->key ? "untracked" : profileTypeNames[entry->type];
+            GetEntryName(entry, name, sizeof(name));
+            GetClassName(entry->classID, className, sizeof(className));
+            fprintf(file, "%s,%d,%s,%s,%u,%llu,%llu\n", type, entry->classID, className, name, entry->calls, (unsigned long long)entry->cycles,
+                    (unsigned long long)(entry->cycles / entry->calls));
+        }
+
+        fclose(file);
+    }
+
+    sprintf_s(fileName, (int32)sizeof(fileName), "S2MProfile_%d.json", exportID);
+    file = fopen(fileName, "w");
+    if (file) {
+        fprintf(file, "{\"traceEvents\":[\n");
+
+        // names are resolved once per entry rather than once per event
+        static char traceNames[PROFILER_ENTRY_COUNT][0x80];
+        for (int32 e = 0; e < entryCount; ++e) GetEntryName(&profileEntries[sortedEntries[e]], traceNames[sortedEntries[e]], sizeof(traceNames[0]));
+
+        uint32 first = traceCount > PROFILER_TRACE_COUNT ? traceCount - PROFILER_TRACE_COUNT : 0;
+        for (uint32 i = first; i < traceCount; ++i) {
+            TraceEvent *event   = &traceEvents[i & (PROFILER_TRACE_COUNT - 1)];
+            ProfileEntry *entry = &profileEntries[event->entryID];
+            fprintf(file, "%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":0,\"args\":{\"classID\":%d}}",
+                    i == first ? "" : ",\n", traceNames[event->entryID], profileTypeNames[entry->type],
+                    (int64)(event->start - captureStartCycles) / cyclesPerMicro, event->duration / cyclesPerMicro, entry->classID);
+        }
+
+        fprintf(file, "\n]}\n");
+        fclose(file);
+    }
+
+    exportID++;
+    Reset();
+}
+#endif
+
+// Zone only exports when the next stage loads, so this is how the last capture gets saved before quitting
+void StateProfiler::StaticUpdate()
+{
+    if (sVars->exportRequested) {
+        sVars->exportRequested = false;
+        StateProfiler::Export();
+    }
+}
+
+void StateProfiler::StageLoad()
+{
+#if S2M_PROFILE
+    sVars->active          = ACTIVE_ALWAYS;
+    sVars->exportRequested = false;
+    Dev::AddViewableVariable("Export Profile", &sVars->exportRequested, Dev::VIEWVAR_BOOL, false, true);
+#endif
+}
+
+#if RETRO_REV0U
+void StateProfiler::StaticLoad(Static *sVars) { RSDK_INIT_STATIC_VARS(StateProfiler); }
+#endif
+
+} // namespace GameLogic
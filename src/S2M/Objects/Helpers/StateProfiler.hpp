@@ -0,0 +1,179 @@
+#pragma once
+#include "S2M.hpp"
+
+// Compile-time opt-in, with S2M_PROFILE off the macros at the bottom compile down to exactly the code they wrap
+#ifndef S2M_PROFILE
+#define S2M_PROFILE (0)
+#endif
+
+#define PROFILER_ENTRY_COUNT (0x1000)  // must be a power of 2
+#define PROFILER_TRACE_COUNT (0x40000) // must be a power of 2
+#define PROFILER_SCOPE_DEPTH (0x40)
+
+#if S2M_PROFILE
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+#endif
+
+namespace GameLogic
+{
+
+struct StateProfiler : RSDK::GameObject::Entity {
+
+    // ==============================
+    // ENUMS
+    // ==============================
+
+    enum ProfileTypes : uint8 {
+        ProfileEvent,
+        ProfileState,
+        ProfileFunction,
+    };
+
+    // ==============================
+    // STRUCTS
+    // ==============================
+
+    // totals for one object event, state or marked function, states are keyed by their function address & the rest by their name
+    // cycles are exclusive, anything timed inside it (a state, a base class event, a marked function) is only counted on that entry
+    struct ProfileEntry {
+        uintptr_t key;
+        const char *name;
+        uint64 cycles;
+        uint32 calls;
+        uint16 classID;
+        uint8 type;
+        uint8 outermost;
+    };
+
+    struct TraceEvent {
+        uint64 start;
+        uint32 duration;
+        uint16 entryID;
+    };
+
+#if S2M_PROFILE
+    struct Scope {
+        Scope(uintptr_t key, uint16 classID, uint8 type, const char *name)
+        {
+            entryID = GetEntry(key, classID, type, name);
+            Enter();
+            start = ReadCycles();
+        }
+        ~Scope() { Record(entryID, start, ReadCycles()); }
+
+        uint64 start;
+        uint16 entryID;
+    };
+#endif
+
+    // ==============================
+    // STATIC VARS
+    // ==============================
+
+    struct Static : RSDK::GameObject::Static {
+        bool32 exportRequested;
+    };
+
+    // ==============================
+    // INSTANCE VARS
+    // ==============================
+
+    // ==============================
+    // EVENTS
+    // ==============================
+
+    static void StaticUpdate();
+    static void StageLoad();
+#if RETRO_REV0U
+    static void StaticLoad(Static *sVars);
+#endif
+
+    // ==============================
+    // FUNCTIONS
+    // ==============================
+
+#if S2M_PROFILE
+    static inline uint64 ReadCycles()
+    {
+#if (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))) || defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+
+    // the first word of the member pointer is the function address for the non-virtual states we use
+    template <typename T> static inline uintptr_t GetStateKey(RSDK::StateMachine<T> *machine)
+    {
+        uintptr_t key = 0;
+        memcpy(&key, &machine->state, sizeof(key));
+        return key;
+    }
+
+    static uint16 GetEntry(uintptr_t key, uint16 classID, uint8 type, const char *name);
+    static void Enter();
+    static void Record(uint16 entryID, uint64 start, uint64 end);
+    static void Reset();
+    // writes everything since the last reset to S2MProfile_<n>.csv & a chrome://tracing compatible S2MProfile_<n>.json, then resets
+    static void Export();
+#else
+    static inline void Reset() {}
+    static inline void Export() {}
+#endif
+
+    // ==============================
+    // DECLARATION
+    // ==============================
+
+    RSDK_DECLARE(StateProfiler);
+};
+} // namespace GameLogic
+
+#if S2M_PROFILE
+#if defined(_MSC_VER)
+#define PROFILER_FUNCTION __FUNCTION__
+#else
+#define PROFILER_FUNCTION __PRETTY_FUNCTION__
+#endif
+
+// only Player & HP_Halfpipe are instrumented so far, so the per class totals in the CSV only cover those two classes & everything else
+// never shows up. StateMachine::Run & the generated event entry points live in the GameAPI submodule and aren't wrapped, every other
+// object needs the macros below added by hand before it's counted
+
+// everything is charged to the running entity's classID, so a base class event called from a derived object (Platform::Update from
+// TilePlatform::Update) counts towards the derived object the same way its states do
+
+// goes at the top of an object's Update, LateUpdate or Draw
+#define S2M_PROFILE_EVENT()                                                                                                                          \
+    GameLogic::StateProfiler::Scope profileScope((uintptr_t)PROFILER_FUNCTION, this->classID, GameLogic::StateProfiler::ProfileEvent,                \
+                                                 PROFILER_FUNCTION)
+
+// StaticUpdate has no entity to go by, so it uses the object's own classID
+#define S2M_PROFILE_STATIC_EVENT()                                                                                                                   \
+    GameLogic::StateProfiler::Scope profileScope((uintptr_t)PROFILER_FUNCTION, sVars->classID, GameLogic::StateProfiler::ProfileEvent,               \
+                                                 PROFILER_FUNCTION)
+
+// for hot entity helpers that aren't states, these show up on their own & are taken out of whatever called them
+#define S2M_PROFILE_FUNCTION()                                                                                                                       \
+    GameLogic::StateProfiler::Scope profileScope((uintptr_t)PROFILER_FUNCTION, this->classID, GameLogic::StateProfiler::ProfileFunction,             \
+                                                 PROFILER_FUNCTION)
+
+// runs the state machine, timing it against whichever state it's currently set to
+#define S2M_PROFILE_STATE(machine, self)                                                                                                             \
+    do {                                                                                                                                             \
+        GameLogic::StateProfiler::Scope profileScope(GameLogic::StateProfiler::GetStateKey(&(machine)), (self)->classID,                            \
+                                                     GameLogic::StateProfiler::ProfileState, nullptr);                                               \
+        (machine).Run(self);                                                                                                                         \
+    } while (0)
+#else
+#define S2M_PROFILE_EVENT()
+#define S2M_PROFILE_STATIC_EVENT()
+#define S2M_PROFILE_FUNCTION()
+#define S2M_PROFILE_STATE(machine, self) (machine).Run(self)
+#endif
@@ -117,8 +117,8 @@ int32 TimeAttackData::GetZoneListPos(int32 zoneID, int32 act, int32 characterID)
         default: break;
     }
 
-    LogHelpers::Print("playerID = %d, zoneID = %d, act = %d", characterID, zoneID, act);
-    LogHelpers::Print("listPos = %d", listPos);
+    LOG_PRINT("playerID = %d, zoneID = %d, act = %d", characterID, zoneID, act);
+    LOG_PRINT("listPos = %d", listPos);
 
     return listPos;
 }
@@ -170,7 +170,7 @@ void TimeAttackData::CreateDB()
 
 uint16 TimeAttackData::LoadDB(void (*callback)(bool32 success))
 {
-    LogHelpers::Print("Loading Time Attack DB");
+    LOG_PRINT("Loading Time Attack DB");
     globals->taTableLoaded = STATUS_CONTINUE;
 
     sVars->loadEntityPtr          = (Entity *)sceneInfo->entity;
@@ -178,7 +178,7 @@ uint16 TimeAttackData::LoadDB(void (*callback)(bool32 success))
     globals->taTableID            = APITable->LoadUserDB("TimeAttackDB.bin", TimeAttackData::LoadDBCallback);
 
     if (globals->taTableID == -1) {
-        LogHelpers::Print("Couldn't claim a slot for loading %s", "TimeAttackDB.bin");
+        LOG_PRINT("Couldn't claim a slot for loading %s", "TimeAttackDB.bin");
         globals->taTableLoaded = STATUS_ERROR;
     }
 
@@ -192,7 +192,7 @@ void TimeAttackData::SaveDB(void (*callback)(bool32 success))
             callback(false);
     }
     else {
-        LogHelpers::Print("Saving Time Attack DB");
+        LOG_PRINT("Saving Time Attack DB");
 
         sVars->saveEntityPtr = (Entity *)sceneInfo->entity;
         sVars->saveCallback  = callback;
@@ -206,17 +206,17 @@ void TimeAttackData::LoadDBCallback(int32 status)
     if (status == STATUS_OK) {
         globals->taTableLoaded = STATUS_OK;
         APITable->SetupUserDBRowSorting(globals->taTableID);
-        LogHelpers::Print("Load Succeeded! Replay count: %d", APITable->GetSortedUserDBRowCount(globals->taTableID));
+        LOG_PRINT("Load Succeeded! Replay count: %d", APITable->GetSortedUserDBRowCount(globals->taTableID));
     }
     else {
-        LogHelpers::Print("Load Failed! Creating new Time Attack DB");
+        LOG_PRINT("Load Failed! Creating new Time Attack DB");
         TimeAttackData::CreateDB();
     }
 
     // Bug Details:
     // Due to how options work, this is called after the db is loaded, but before the result is assigned to globals->taTableID
     // meaning that globals->taTableID will be 0xFFFF initially, even if the tabel id was loaded and returned successfully
-    LogHelpers::Print("Replay DB Slot => %d, Load Status => %d", globals->taTableID, globals->taTableLoaded);
+    LOG_PRINT("Replay DB Slot => %d, Load Status => %d", globals->taTableID, globals->taTableLoaded);
 
     if (sVars->loadCallback) {
         Entity *entStore = (Entity *)sceneInfo->entity;
@@ -249,9 +249,9 @@ void TimeAttackData::MigrateLegacySaves()
     if (globals->saveLoaded == STATUS_OK) {
         sVars->isMigratingData = true;
 
-        LogHelpers::Print("===========================");
-        LogHelpers::Print("Migrating Legacy TA Data...");
-        LogHelpers::Print("===========================");
+        LOG_PRINT("===========================");
+        LOG_PRINT("Migrating Legacy TA Data...");
+        LOG_PRINT("===========================");
 
         for (int32 zone = Zone::OWZ; zone <= Zone::DEZ; ++zone) {
             for (int32 act = ACT_1; act <= ACT_2; ++act) {
@@ -260,7 +260,7 @@ void TimeAttackData::MigrateLegacySaves()
                         uint16 *records = TimeAttackData::GetRecordedTime(zone, act, charID, rank + 1);
                         if (records && *records) {
                             int32 score = *records;
-                            LogHelpers::Print("Import: zone=%d act=%d charID=%d rank=%d -> %d", zone, act, charID, rank, score);
+                            LOG_PRINT("Import: zone=%d act=%d charID=%d rank=%d -> %d", zone, act, charID, rank, score);
                             TimeAttackData::AddRecord(zone, act, charID, score, nullptr);
                         }
                     }
@@ -291,10 +291,10 @@ int32 TimeAttackData::AddDBRow(uint8 zoneID, uint8 act, uint8 characterID, int32
     memset(buf, 0, sizeof(buf));
     APITable->GetUserDBRowCreationTime(globals->taTableID, rowID, buf, sizeof(buf) - 1, "%Y/%m/%d %H:%M:%S");
 
-    LogHelpers::Print("Time Attack DB Added Entry");
-    LogHelpers::Print("Created at %s", buf);
-    LogHelpers::Print("Row ID: %d", rowID);
-    LogHelpers::Print("UUID: %08X", uuid);
+    LOG_PRINT("Time Attack DB Added Entry");
+    LOG_PRINT("Created at %s", buf);
+    LOG_PRINT("Row ID: %d", rowID);
+    LOG_PRINT("UUID: %08X", uuid);
 
     return rowID;
 }
@@ -385,7 +385,7 @@ int32 TimeAttackData::GetReplayID(uint8 zoneID, uint8 act, uint8 characterID, in
 
 void TimeAttackData::ConfigureTableView(uint8 zoneID, uint8 act, uint8 characterID)
 {
-    LogHelpers::Print("ConfigureTableView(%d, %d, %d, %d)", characterID, zoneID, act);
+    LOG_PRINT("ConfigureTableView(%d, %d, %d, %d)", characterID, zoneID, act);
 
     // setup every sort row ID for every entry
     APITable->SetupUserDBRowSorting(globals->taTableID);
@@ -407,7 +407,7 @@ void TimeAttackData::ConfigureTableView(uint8 zoneID, uint8 act, uint8 character
 void TimeAttackData::Leaderboard_GetRank(bool32 success, int32 rank)
 {
     if (success) {
-        LogHelpers::Print("Got back leaderboard rank: %d. Not bad!", rank);
+        LOG_PRINT("Got back leaderboard rank: %d. Not bad!", rank);
         sVars->leaderboardRank = rank;
     }
 }
@@ -161,7 +161,7 @@ void DASetup::SetupUI()
     DASetup::DisplayTrack(0);
     UIInfoLabel *trackSelLabel = sVars->trackSelLabel;
     Localization::GetString(&buffer, Localization::SelectATrack);
-    LogHelpers::PrintString(&buffer);
+    LOG_PRINT_STRING(&buffer);
     UIInfoLabel::SetString(trackSelLabel, &buffer);
 }
 
@@ -90,7 +90,7 @@ void ExtrasMenu::Initialize()
     String tag = {};
     tag.Set("Extras");
 
-    LogHelpers::Print("ManiaModeMenu::Initialize()");
+    LOG_PRINT("ManiaModeMenu::Initialize()");
 
     for (auto control : GameObject::GetEntities<UIControl>(FOR_ALL_ENTITIES))
     {
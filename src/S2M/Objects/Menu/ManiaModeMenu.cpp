@@ -44,7 +44,7 @@ void ManiaModeMenu::StageLoad() {}
 
 void ManiaModeMenu::Initialize()
 {
-    LogHelpers::Print("ManiaModeMenu::Initialize()");
+    LOG_PRINT("ManiaModeMenu::Initialize()");
 
     MainMenu::Initialize();
     SaveMenu::Initialize();
@@ -112,7 +112,7 @@ void MenuSetup::Create(void *data)
 void MenuSetup::StageLoad()
 {
     MenuParam *param = (MenuParam *)globals->menuParam;
-    LogHelpers::Print("Menu recall ctrl: %s", param->menuTag);
+    LOG_PRINT("Menu recall ctrl: %s", param->menuTag);
 
     sVars->initializedMenuReturn = false;
     sVars->initializedMenu       = false;
@@ -127,19 +127,19 @@ void MenuSetup::StageLoad()
 
     if (!sceneInfo->inEditor) {
         switch (SKU->platform) {
-            case PLATFORM_PC: LogHelpers::Print("PC SKU"); break;
-            case PLATFORM_PS4: LogHelpers::Print("PS4 SKU"); break;
-            case PLATFORM_XB1: LogHelpers::Print("XB1 SKU"); break;
-            case PLATFORM_SWITCH: LogHelpers::Print("NX SKU"); break;
-            case PLATFORM_DEV: LogHelpers::Print("DEV SKU"); break;
-            default: LogHelpers::Print("INVALID PLATFORM: %d", SKU->platform); break;
+            case PLATFORM_PC: LOG_PRINT("PC SKU"); break;
+            case PLATFORM_PS4: LOG_PRINT("PS4 SKU"); break;
+            case PLATFORM_XB1: LOG_PRINT("XB1 SKU"); break;
+            case PLATFORM_SWITCH: LOG_PRINT("NX SKU"); break;
+            case PLATFORM_DEV: LOG_PRINT("DEV SKU"); break;
+            default: LOG_PRINT("INVALID PLATFORM: %d", SKU->platform); break;
         }
 
         switch (SKU->region) {
-            case REGION_US: LogHelpers::Print("US REGION"); break;
-            case REGION_JP: LogHelpers::Print("JP REGION"); break;
-            case REGION_EU: LogHelpers::Print("EU REGION"); break;
-            default: LogHelpers::Print("INVALID REGION: %d", SKU->region); break;
+            case REGION_US: LOG_PRINT("US REGION"); break;
+            case REGION_JP: LOG_PRINT("JP REGION"); break;
+            case REGION_EU: LOG_PRINT("EU REGION"); break;
+            default: LOG_PRINT("INVALID REGION: %d", SKU->region); break;
         }
     }
 
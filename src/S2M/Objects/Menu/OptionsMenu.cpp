@@ -126,7 +126,7 @@ void OptionsMenu::StageLoad() {}
 
 void OptionsMenu::Initialize()
 {
-    LogHelpers::Print("ManiaModeMenu::Initialize()");
+    LOG_PRINT("ManiaModeMenu::Initialize()");
 
     String tag = {};
 
@@ -803,7 +803,7 @@ void OptionsMenu::AreYouSureDlg_YesCB_EraseTimeAttack()
     APITable->RemoveAllDBRows(globals->taTableID);
 
     TimeAttackData::SaveDB(&OptionsMenu::EraseSaveDataCB);
-    LogHelpers::Print("TimeAttack table ID = %d, status = %d", globals->taTableID, globals->taTableLoaded);
+    LOG_PRINT("TimeAttack table ID = %d, status = %d", globals->taTableID, globals->taTableLoaded);
 }
 
 void OptionsMenu::EraseTimeAttackButton_ActionCB()
@@ -5,6 +5,7 @@
 // ---------------------------------------------------------------------
 
 #include "ThanksSetup.hpp"
+#include "Global/Zone.hpp"
 #include "UIPicture.hpp"
 #include "Global/Music.hpp"
 
@@ -66,11 +67,11 @@ void ThanksSetup::State_ThanksForPlaying()
 void ThanksSetup::State_FadeOut()
 {
     if (this->timer >= 1024) {
-        if (Stage::CheckSceneFolder("Thanks")) {
+        if (Zone::SceneFolder() == SceneIdentity::FolderThanks) {
             Stage::SetScene("Presentation", "Menu");
             Stage::LoadScene();
         }
-        else if (Stage::CheckSceneFolder("Credits")) {
+        else if (Zone::SceneFolder() == SceneIdentity::FolderCredits) {
             Stage::SetScene("Presentation", "Signatures");
             Stage::LoadScene();
         }
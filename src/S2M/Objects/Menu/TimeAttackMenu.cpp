@@ -170,6 +170,7 @@ void TimeAttackMenu::SetupActions()
     UIControl *detailsControl = sVars->taDetailsControl;
 
     control->menuUpdateCB.Set(&TimeAttackMenu::MenuUpdateCB);
+    control->backPressCB.Set(&TimeAttackMenu::BackPressCB_Characters);
 
     UIButton *replaysButton = control->buttons[control->buttonCount - 1];
     replaysButton->actionCB.Set(&TimeAttackMenu::ReplayButton_ActionCB);
@@ -336,8 +337,8 @@ void TimeAttackMenu::WatchReplay(int32 row, bool32 showGhost)
     Input::AssignInputSlotToDevice(Input::CONT_P1, id);
 
     uint32 uuid = APITable->GetUserDBRowUUID(globals->replayTableID, row);
-    LogHelpers::Print("Go_Replay(%d, %d)", row, showGhost);
-    LogHelpers::Print("uuid: %08X", uuid);
+    LOG_PRINT("Go_Replay(%d, %d)", row, showGhost);
+    LOG_PRINT("uuid: %08X", uuid);
 
     int32 score       = 0;
     uint8 zoneID      = 0;
@@ -381,8 +382,13 @@ void TimeAttackMenu::WatchReplay(int32 row, bool32 showGhost)
     char fileName[0x20];
     sprintf_s(fileName, (int32)sizeof(fileName), "Replay_%08X.bin", uuid);
 
-    memset(globals->replayTempRBuffer, 0, sizeof(globals->replayTempRBuffer));
-    memset(globals->replayReadBuffer, 0, sizeof(globals->replayReadBuffer));
+    if (!ReplayRecorder::AcquireBuffers()) {
+        TimeAttackMenu::ReplayLoad_CB(false);
+        return;
+    }
+
+    memset(globals->replayTempRBuffer, 0, REPLAY_BUFFER_SIZE);
+    memset(globals->replayReadBuffer, 0, REPLAY_BUFFER_SIZE);
     ReplayRecorder::Buffer_LoadFile(fileName, globals->replayTempRBuffer, TimeAttackMenu::ReplayLoad_CB);
 }
 
@@ -395,7 +401,7 @@ void TimeAttackMenu::ReplayLoad_CB(bool32 success)
         ReplayRecorder::Replay *replayPtr = (ReplayRecorder::Replay *)globals->replayTempRBuffer;
 
         if (replayPtr->header.version == GAME_VERSION) {
-            LogHelpers::Print("WARNING: Replay Load OK");
+            LOG_PRINT("WARNING: Replay Load OK");
             ReplayRecorder::Buffer_Unpack(globals->replayReadBuffer, globals->replayTempRBuffer);
             TimeAttackMenu::LoadScene_Fadeout();
             return;
@@ -611,9 +617,11 @@ void TimeAttackMenu::StartTAAttempt()
     param->menuSelection = 0;
     param->inTimeAttack  = true;
 
-    ReplayRecorder::Replay *replayPtr = (ReplayRecorder::Replay *)globals->replayReadBuffer;
-    if (replayPtr->header.isNotEmpty && replayPtr->header.signature == REPLAY_SIGNATURE)
-        memset(globals->replayReadBuffer, 0, sizeof(globals->replayReadBuffer));
+    if (ReplayRecorder::AcquireBuffers()) {
+        ReplayRecorder::Replay *replayPtr = (ReplayRecorder::Replay *)globals->replayReadBuffer;
+        if (replayPtr->header.isNotEmpty && replayPtr->header.signature == REPLAY_SIGNATURE)
+            memset(globals->replayReadBuffer, 0, REPLAY_BUFFER_SIZE);
+    }
 
     TimeAttackMenu::LoadScene();
 }
@@ -670,6 +678,21 @@ void TimeAttackMenu::LoadScene()
 
 void TimeAttackMenu::YPressCB_ZoneSel() {}
 
+bool32 TimeAttackMenu::BackPressCB_Characters()
+{
+    // leaving time attack for the main menu, nothing needs the replay buffers until we come back
+    ReplayRecorder::ReleaseBuffers();
+
+    // same as UIControl's default back press
+    UIControl *control = sVars->timeAttackControl;
+    if (control->parentTag.length > 0) {
+        control->selectionDisabled = true;
+        UITransition::StartTransition(UIControl::ReturnToParentMenu, 0, true);
+    }
+
+    return false;
+}
+
 bool32 TimeAttackMenu::BackPressCB_ZoneSel()
 {
     UITransition::SetNewTag("Time Attack");
@@ -836,7 +859,7 @@ void TimeAttackMenu::SetupLeaderboardsCarousel(UICarousel *carousel)
             max += parent->buttonCount;
 
         int32 vIndex = max + carousel->scrollOffset;
-        LogHelpers::Print("i = %d, vIndex = %d", i, vIndex);
+        LOG_PRINT("i = %d, vIndex = %d", i, vIndex);
 
         if (vIndex == carousel->virtualIndex) {
             parent->buttonID = i;
@@ -844,11 +867,11 @@ void TimeAttackMenu::SetupLeaderboardsCarousel(UICarousel *carousel)
         }
     }
 
-    LogHelpers::Print("avail.start = %d, length = %d", avail.start, avail.length);
-    LogHelpers::Print("scrollOffset = %d", carousel->scrollOffset);
-    LogHelpers::Print("virtualIndex = %d", carousel->virtualIndex);
-    LogHelpers::Print("minOffset = %d", carousel->minOffset);
-    LogHelpers::Print("maxOffset = %d", carousel->maxOffset);
+    LOG_PRINT("avail.start = %d, length = %d", avail.start, avail.length);
+    LOG_PRINT("scrollOffset = %d", carousel->scrollOffset);
+    LOG_PRINT("virtualIndex = %d", carousel->virtualIndex);
+    LOG_PRINT("minOffset = %d", carousel->minOffset);
+    LOG_PRINT("maxOffset = %d", carousel->maxOffset);
 
     carousel->buttonID = -1;
 }
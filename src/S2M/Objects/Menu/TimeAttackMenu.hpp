@@ -95,6 +95,7 @@ struct TimeAttackMenu : RSDK::GameObject::Entity {
     void TAModule_ActionCB();
     static void StartTAAttempt();
     static void LoadScene();
+    static bool32 BackPressCB_Characters();
     static void YPressCB_ZoneSel();
     static bool32 BackPressCB_ZoneSel();
     static void YPressCB_Details();
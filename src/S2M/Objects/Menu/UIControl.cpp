@@ -56,6 +56,9 @@ void UIControl::StaticUpdate()
 
     sVars->forceBackPress = false;
 
+    // anything created after the scene finished loading isn't in the menu index, so stop using it
+    sVars->menuIndexState = MENUINDEX_DISABLED;
+
     ++sVars->timer;
     sVars->timer &= 0x7FFF;
 }
@@ -96,24 +99,44 @@ void UIControl::Create(void *data)
         this->startPos.x = this->position.x;
         this->startPos.y = this->position.y;
 
+        this->tagID = UIControl::GetTagID(&this->tag);
+
+        if (sVars->menuIndexState == MENUINDEX_UNBUILT)
+            UIControl::BuildMenuIndex();
+
         int32 slotID = this->Slot();
         if (UIButtonPrompt::sVars && slotID != SLOT_DIALOG_UICONTROL) {
-            for (auto prompt : GameObject::GetEntities<UIButtonPrompt>(FOR_ALL_ENTITIES)) {
-                if (this->promptCount < UICONTROL_PROMPT_COUNT) {
-                    int32 x = this->startPos.x - this->cameraOffset.x;
-                    int32 y = this->startPos.y - this->cameraOffset.y;
-
-                    Hitbox hitbox;
-                    hitbox.right  = this->size.x >> 17;
-                    hitbox.left   = -(this->size.x >> 17);
-                    hitbox.bottom = this->size.y >> 17;
-                    hitbox.top    = -(this->size.y >> 17);
+            int32 x = this->startPos.x - this->cameraOffset.x;
+            int32 y = this->startPos.y - this->cameraOffset.y;
+
+            Hitbox hitbox;
+            hitbox.right  = this->size.x >> 17;
+            hitbox.left   = -(this->size.x >> 17);
+            hitbox.bottom = this->size.y >> 17;
+            hitbox.top    = -(this->size.y >> 17);
+
+            if (sVars->menuIndexState == MENUINDEX_READY) {
+                uint16 slots[UICONTROL_INDEX_COUNT];
+                int32 count = UIControl::QueryMenuIndex(MENUINDEX_PROMPT, x, y, &hitbox, slots);
+
+                for (int32 i = 0; i < count && this->promptCount < UICONTROL_PROMPT_COUNT; ++i) {
+                    UIButtonPrompt *prompt = GameObject::Get<UIButtonPrompt>(slots[i]);
                     if (MathHelpers::PointInHitbox(x, y, prompt->position.x, prompt->position.y, FLIP_NONE, &hitbox)) {
                         prompt->parent                     = (Entity *)this;
                         this->prompts[this->promptCount++] = prompt;
                     }
                 }
             }
+            else {
+                for (auto prompt : GameObject::GetEntities<UIButtonPrompt>(FOR_ALL_ENTITIES)) {
+                    if (this->promptCount < UICONTROL_PROMPT_COUNT) {
+                        if (MathHelpers::PointInHitbox(x, y, prompt->position.x, prompt->position.y, FLIP_NONE, &hitbox)) {
+                            prompt->parent                     = (Entity *)this;
+                            this->prompts[this->promptCount++] = prompt;
+                        }
+                    }
+                }
+            }
         }
 
         analogStickInfoL[1].deadzone = 0.75f;
@@ -144,6 +167,141 @@ void UIControl::StageLoad()
     sVars->lockInput         = false;
     sVars->active            = ACTIVE_ALWAYS;
     sVars->isProcessingInput = false;
+    sVars->menuIndexState    = MENUINDEX_UNBUILT;
+}
+
+void UIControl::BuildMenuIndex()
+{
+    sVars->menuIndexState = MENUINDEX_READY;
+    sVars->menuIndexCount = 0;
+    for (int32 c = 0; c < UICONTROL_INDEX_CELL_COUNT; ++c) sVars->menuIndexCells[c] = -1;
+
+    for (int32 i = 0; i < ENTITY_COUNT; ++i) {
+        Entity *entity = GameObject::Get(i);
+        if (!entity || !entity->classID)
+            continue;
+
+        uint16 classID = entity->classID;
+        uint8 type     = MENUINDEX_BUTTON;
+        if (i < SCENEENTITY_COUNT
+            && (classID == UIButton::sVars->classID || (UISaveSlot::sVars && classID == UISaveSlot::sVars->classID)
+                || (UICharButton::sVars && classID == UICharButton::sVars->classID)
+                || (UITAZoneModule::sVars && classID == UITAZoneModule::sVars->classID)
+                || (UIRankButton::sVars && classID == UIRankButton::sVars->classID)
+                || (UIReplayCarousel::sVars && classID == UIReplayCarousel::sVars->classID)
+                || (UISlider::sVars && classID == UISlider::sVars->classID) || (UIKeyBinder::sVars && classID == UIKeyBinder::sVars->classID))) {
+            type = MENUINDEX_BUTTON;
+        }
+        else if (UIShifter::sVars && classID == UIShifter::sVars->classID) {
+            type = MENUINDEX_SHIFTER;
+        }
+        else if (UICarousel::sVars && classID == UICarousel::sVars->classID) {
+            type = MENUINDEX_CAROUSEL;
+        }
+        else if (UIButtonPrompt::sVars && classID == UIButtonPrompt::sVars->classID) {
+            type = MENUINDEX_PROMPT;
+        }
+        else {
+            continue;
+        }
+
+        if (sVars->menuIndexCount >= UICONTROL_INDEX_COUNT) {
+            // too many UI entities to track, just fall back to scanning the scene
+            sVars->menuIndexState = MENUINDEX_DISABLED;
+            return;
+        }
+
+        uint32 cellX = (uint32)(entity->position.x >> UICONTROL_INDEX_CELL_SHIFT);
+        uint32 cellY = (uint32)(entity->position.y >> UICONTROL_INDEX_CELL_SHIFT);
+        int32 cell   = ((cellX * 0x9E37) ^ (cellY * 0x85EB)) & (UICONTROL_INDEX_CELL_COUNT - 1);
+
+        MenuIndexEntry *indexEntry = &sVars->menuIndex[sVars->menuIndexCount];
+        indexEntry->slot           = i;
+        indexEntry->classID        = classID;
+        indexEntry->type           = type;
+        indexEntry->next           = sVars->menuIndexCells[cell];
+
+        sVars->menuIndexCells[cell] = sVars->menuIndexCount++;
+    }
+}
+
+int32 UIControl::QueryMenuIndex(uint8 type, int32 x, int32 y, Hitbox *hitbox, uint16 *slots)
+{
+    int32 left   = x + (MIN(hitbox->left, hitbox->right) << 16);
+    int32 right  = x + (MAX(hitbox->left, hitbox->right) << 16);
+    int32 top    = y + (MIN(hitbox->top, hitbox->bottom) << 16);
+    int32 bottom = y + (MAX(hitbox->top, hitbox->bottom) << 16);
+
+    int32 cellL = left >> UICONTROL_INDEX_CELL_SHIFT;
+    int32 cellR = right >> UICONTROL_INDEX_CELL_SHIFT;
+    int32 cellT = top >> UICONTROL_INDEX_CELL_SHIFT;
+    int32 cellB = bottom >> UICONTROL_INDEX_CELL_SHIFT;
+
+    int32 count = 0;
+    if ((cellR - cellL + 1) * (cellB - cellT + 1) >= UICONTROL_INDEX_CELL_COUNT) {
+        // covers (nearly) every bucket anyways
+        for (int32 e = 0; e < sVars->menuIndexCount; ++e) {
+            MenuIndexEntry *indexEntry = &sVars->menuIndex[e];
+            if (count < UICONTROL_INDEX_COUNT && indexEntry->type == type && GameObject::Get(indexEntry->slot)->classID == indexEntry->classID)
+                slots[count++] = indexEntry->slot;
+        }
+    }
+    else {
+        // several cells can hash to the same bucket, so each bucket is only walked once. Every entry lives in exactly one bucket, so that's
+        // enough to keep the results unique
+        uint64 visitedCells = 0;
+        for (int32 cy = cellT; cy <= cellB; ++cy) {
+            for (int32 cx = cellL; cx <= cellR; ++cx) {
+                int32 cell = (((uint32)cx * 0x9E37) ^ ((uint32)cy * 0x85EB)) & (UICONTROL_INDEX_CELL_COUNT - 1);
+                if (visitedCells & (1ULL << cell))
+                    continue;
+                visitedCells |= 1ULL << cell;
+
+                for (int32 e = sVars->menuIndexCells[cell]; e >= 0 && count < UICONTROL_INDEX_COUNT; e = sVars->menuIndex[e].next) {
+                    MenuIndexEntry *indexEntry = &sVars->menuIndex[e];
+                    if (indexEntry->type == type && GameObject::Get(indexEntry->slot)->classID == indexEntry->classID)
+                        slots[count++] = indexEntry->slot;
+                }
+            }
+        }
+
+        // buckets don't follow slot order, so put the results back into it
+        for (int32 i = 1; i < count; ++i) {
+            uint16 slot = slots[i];
+            int32 j     = i - 1;
+            for (; j >= 0 && slots[j] > slot; --j) slots[j + 1] = slots[j];
+            slots[j + 1] = slot;
+        }
+    }
+
+    return count;
+}
+
+uint32 UIControl::GetTagID(const char *text)
+{
+    // FNV-1a, case-insensitive to match String::Compare(..., false)
+    uint32 hash = 0x811C9DC5;
+    for (; *text; ++text) {
+        uint32 c = (uint8)*text;
+        if (c >= 'a' && c <= 'z')
+            c -= 'a' - 'A';
+        hash = (hash ^ c) * 0x01000193;
+    }
+
+    return hash;
+}
+
+uint32 UIControl::GetTagID(String *text)
+{
+    uint32 hash = 0x811C9DC5;
+    for (int32 i = 0; i < text->length; ++i) {
+        uint32 c = text->chars[i];
+        if (c >= 'a' && c <= 'z')
+            c -= 'a' - 'A';
+        hash = (hash ^ c) * 0x01000193;
+    }
+
+    return hash;
 }
 
 UIControl *UIControl::GetUIControl()
@@ -290,11 +448,11 @@ void UIControl::ProcessInputs()
                     return;
             }
             else {
-                LogHelpers::Print("Backout prevented");
-                LogHelpers::Print("childHasFocus = %d", this->childHasFocus);
-                LogHelpers::Print("dialogHasFocus = %d", this->dialogHasFocus);
-                LogHelpers::Print("popoverHasFocus = %d", this->popoverHasFocus);
-                LogHelpers::Print("backoutTimer = %d", this->backoutTimer);
+                LOG_PRINT_VERBOSE("Backout prevented");
+                LOG_PRINT_VERBOSE("childHasFocus = %d", this->childHasFocus);
+                LOG_PRINT_VERBOSE("dialogHasFocus = %d", this->dialogHasFocus);
+                LOG_PRINT_VERBOSE("popoverHasFocus = %d", this->popoverHasFocus);
+                LOG_PRINT_VERBOSE("backoutTimer = %d", this->backoutTimer);
             }
         }
 
@@ -393,7 +551,7 @@ void UIControl::SetActiveMenuButtonPrompts(UIControl *entity)
 
 void UIControl::SetActiveMenu(UIControl *entity)
 {
-    LogHelpers::PrintString(&entity->tag);
+    LOG_PRINT_STRING(&entity->tag);
 
     entity->active  = ACTIVE_ALWAYS;
     entity->visible = true;
@@ -482,17 +640,61 @@ void UIControl::SetupButtons()
 {
     int32 slotID = this->Slot();
 
+    int32 x = this->startPos.x - this->cameraOffset.x;
+    int32 y = this->startPos.y - this->cameraOffset.y;
+
     Hitbox hitboxRange;
+    hitboxRange.left   = -(this->size.x >> 17);
+    hitboxRange.top    = -(this->size.y >> 17);
+    hitboxRange.right  = this->size.x >> 17;
+    hitboxRange.bottom = this->size.y >> 17;
+
+    if (sVars->menuIndexState == MENUINDEX_UNBUILT)
+        UIControl::BuildMenuIndex();
+
+    if (sVars->menuIndexState == MENUINDEX_READY) {
+        uint16 slots[UICONTROL_INDEX_COUNT];
+        int32 count = 0;
+
+        if (slotID != SLOT_DIALOG_UICONTROL) {
+            count = UIControl::QueryMenuIndex(MENUINDEX_SHIFTER, x, y, &hitboxRange, slots);
+            for (int32 i = 0; i < count; ++i) {
+                UIShifter *shifter = GameObject::Get<UIShifter>(slots[i]);
+
+                if (MathHelpers::PointInHitbox(x, y, shifter->position.x, shifter->position.y, FLIP_NONE, &hitboxRange)) {
+                    this->shifter   = shifter;
+                    shifter->parent = this;
+                }
+            }
+
+            count = UIControl::QueryMenuIndex(MENUINDEX_CAROUSEL, x, y, &hitboxRange, slots);
+            for (int32 i = 0; i < count; ++i) {
+                UICarousel *carousel = GameObject::Get<UICarousel>(slots[i]);
+
+                if (MathHelpers::PointInHitbox(x, y, carousel->position.x, carousel->position.y, FLIP_NONE, &hitboxRange)) {
+                    this->carousel   = carousel;
+                    carousel->parent = this;
+                }
+            }
+        }
+
+        count = UIControl::QueryMenuIndex(MENUINDEX_BUTTON, x, y, &hitboxRange, slots);
+        for (int32 i = 0; i < count && this->buttonCount < UICONTROL_BUTTON_COUNT; ++i) {
+            UIButton *button = GameObject::Get<UIButton>(slots[i]);
+
+            if (MathHelpers::PointInHitbox(x, y, button->position.x, button->position.y, FLIP_NONE, &hitboxRange)) {
+                if (!button->parent)
+                    button->parent = (Entity *)this;
+
+                this->buttons[this->buttonCount++] = button;
+            }
+        }
+
+        return;
+    }
 
     if (UIShifter::sVars && slotID != SLOT_DIALOG_UICONTROL) {
         for (auto shifter : GameObject::GetEntities<UIShifter>(FOR_ALL_ENTITIES)) {
-            int32 x            = this->startPos.x - this->cameraOffset.x;
-            int32 y            = this->startPos.y - this->cameraOffset.y;
-            hitboxRange.right  = this->size.x >> 17;
-            hitboxRange.left   = -(this->size.x >> 17);
-            hitboxRange.bottom = (this->size.y >> 17);
-            hitboxRange.top    = -(this->size.y >> 17);
-
             if (MathHelpers::PointInHitbox(x, y, shifter->position.x, shifter->position.y, FLIP_NONE, &hitboxRange)) {
                 this->shifter   = shifter;
                 shifter->parent = this;
@@ -502,13 +704,6 @@ void UIControl::SetupButtons()
 
     if (UICarousel::sVars && slotID != SLOT_DIALOG_UICONTROL) {
         for (auto carousel : GameObject::GetEntities<UICarousel>(FOR_ALL_ENTITIES)) {
-            int32 x            = this->startPos.x - this->cameraOffset.x;
-            int32 y            = this->startPos.y - this->cameraOffset.y;
-            hitboxRange.right  = this->size.x >> 17;
-            hitboxRange.left   = -(this->size.x >> 17);
-            hitboxRange.bottom = this->size.y >> 17;
-            hitboxRange.top    = -(this->size.y >> 17);
-
             if (MathHelpers::PointInHitbox(x, y, carousel->position.x, carousel->position.y, FLIP_NONE, &hitboxRange)) {
                 this->carousel   = carousel;
                 carousel->parent = this;
@@ -529,13 +724,6 @@ void UIControl::SetupButtons()
                 && (!UISlider::sVars || classID != UISlider::sVars->classID) && (!UIKeyBinder::sVars || classID != UIKeyBinder::sVars->classID)) {
             }
             else {
-                int32 x            = this->startPos.x - this->cameraOffset.x;
-                int32 y            = this->startPos.y - this->cameraOffset.y;
-                hitboxRange.left   = -(this->size.x >> 17);
-                hitboxRange.top    = -(this->size.y >> 17);
-                hitboxRange.right  = this->size.x >> 17;
-                hitboxRange.bottom = this->size.y >> 17;
-
                 if (MathHelpers::PointInHitbox(x, y, button->position.x, button->position.y, FLIP_NONE, &hitboxRange)) {
                     if (this->buttonCount < UICONTROL_BUTTON_COUNT) {
                         if (!button->parent)
@@ -568,12 +756,15 @@ bool32 UIControl::isMoving(UIControl *entity)
 
 void UIControl::MatchMenuTag(const char *text)
 {
+    uint32 tagID = UIControl::GetTagID(text);
+
     String string;
     string.Init(nullptr);
 
     string.Set(text);
     for (auto entity : GameObject::GetEntities<UIControl>(FOR_ALL_ENTITIES)) {
-        if (entity->active == ACTIVE_ALWAYS || !string.Compare(&string, &entity->tag, false))
+        // only fall through to the string compare if the IDs match, in case of collisions
+        if (entity->active == ACTIVE_ALWAYS || entity->tagID != tagID || !string.Compare(&string, &entity->tag, false))
             entity->SetInactiveMenu(entity);
         else
             UIControl::SetActiveMenu(entity);
@@ -583,8 +774,10 @@ void UIControl::MatchMenuTag(const char *text)
 void UIControl::HandleMenuChange(String *newMenuTag)
 {
     if (newMenuTag->length) {
+        uint32 tagID = UIControl::GetTagID(newMenuTag);
+
         for (auto entity : GameObject::GetEntities<UIControl>(FOR_ALL_ENTITIES)) {
-            if (entity->active == ACTIVE_ALWAYS || !newMenuTag->Compare(newMenuTag, &entity->tag, false))
+            if (entity->active == ACTIVE_ALWAYS || entity->tagID != tagID || !newMenuTag->Compare(newMenuTag, &entity->tag, false))
                 entity->SetInactiveMenu(entity);
             else
                 UIControl::SetActiveMenu(entity);
@@ -16,16 +16,41 @@ struct UIShifter;
 
 #define UICONTROL_PROMPT_COUNT (4)
 
+// menu index: UI entities are swept once while the menu loads & bucketed into a hashed grid of 512px cells
+#define UICONTROL_INDEX_COUNT      (0x200)
+#define UICONTROL_INDEX_CELL_COUNT (0x40) // must be a power of 2, no more than 64 since queries track visited buckets in a uint64
+#define UICONTROL_INDEX_CELL_SHIFT (25)   // 512px in 16.16 fixed point
+
 struct UIControl : RSDK::GameObject::Entity {
 
     // ==============================
     // ENUMS
     // ==============================
 
+    enum MenuIndexTypes {
+        MENUINDEX_BUTTON,
+        MENUINDEX_SHIFTER,
+        MENUINDEX_CAROUSEL,
+        MENUINDEX_PROMPT,
+    };
+
+    enum MenuIndexStates {
+        MENUINDEX_UNBUILT,
+        MENUINDEX_READY,
+        MENUINDEX_DISABLED, // scene load is over (or the index overflowed), entities created from here on aren't tracked
+    };
+
     // ==============================
     // STRUCTS
     // ==============================
 
+    struct MenuIndexEntry {
+        uint16 slot;
+        uint16 classID;
+        uint8 type;
+        int16 next;
+    };
+
     // ==============================
     // STATIC VARS
     // ==============================
@@ -56,6 +81,10 @@ struct UIControl : RSDK::GameObject::Entity {
         bool32 hasTouchInput;
         int32 timer;
         RSDK::SpriteAnimation aniFrames;
+        int32 menuIndexState;
+        int32 menuIndexCount;
+        int16 menuIndexCells[UICONTROL_INDEX_CELL_COUNT];
+        MenuIndexEntry menuIndex[UICONTROL_INDEX_COUNT];
     };
 
     RSDK::StateMachine<UIControl> state;
@@ -63,6 +92,7 @@ struct UIControl : RSDK::GameObject::Entity {
     int32 buttonID;
     RSDK::String tag;
     RSDK::String parentTag;
+    uint32 tagID;
     bool32 activeOnLoad;
     bool32 noWidgets;
     bool32 resetSelection;
@@ -131,6 +161,12 @@ struct UIControl : RSDK::GameObject::Entity {
     void SetInactiveMenu(UIControl *entity);
     void SetupButtons();
 
+    static void BuildMenuIndex();
+    static int32 QueryMenuIndex(uint8 type, int32 x, int32 y, RSDK::Hitbox *hitbox, uint16 *slots);
+
+    static uint32 GetTagID(const char *text);
+    static uint32 GetTagID(RSDK::String *text);
+
     static UIControl *GetUIControl();
     static bool32 isMoving(UIControl *entity);
     static void MatchMenuTag(const char *text);
@@ -5,6 +5,7 @@
 // ---------------------------------------------------------------------
 
 #include "UIDialog.hpp"
+#include "Global/Zone.hpp"
 #include "UIWidgets.hpp"
 #include "Helpers/LogHelpers.hpp"
 #include "Helpers/MathHelpers.hpp"
@@ -109,13 +110,13 @@ void UIDialog::StageLoad()
 UIDialog *UIDialog::CreateActiveDialog(String *msg)
 {
     if (UIDialog::sVars->activeDialog) {
-        LogHelpers::Print("EXCEPTION: Called CreateDialog when an activeDialog already existed.");
+        LOG_PRINT("EXCEPTION: Called CreateDialog when an activeDialog already existed.");
     }
     else {
         int32 id = GameObject::Get<UIDialog>(SLOT_DIALOG)->classID;
 
         if (id) {
-            LogHelpers::Print("Can't create UIDialog (%d), entity already exists in slot (class ID: %d)", UIDialog::sVars->classID, id);
+            LOG_PRINT("Can't create UIDialog (%d), entity already exists in slot (class ID: %d)", UIDialog::sVars->classID, id);
         }
         else {
             GameObject::Reset(SLOT_DIALOG, UIDialog::sVars->classID, msg);
@@ -168,7 +169,7 @@ void UIDialog::AddButton(uint8 frame, UIDialog *dialog, RSDK::Action<void> callb
         button->position.x = (screenInfo->position.x + screenInfo->center.x) << 16;
         button->position.y = (screenInfo->position.y + screenInfo->center.y) << 16;
         button->visibleArrow = true;
-        if (Stage::CheckSceneFolder("Menu")) { // if its the menu, load these, load others if not
+        if (Zone::SceneFolder() == SceneIdentity::FolderMenu) { // if its the menu, load these, load others if not
             button->buttonListID  = 16;
             button->buttonFrameID = 1;
             button->nameListID  = 25;
@@ -95,7 +95,7 @@ void UIKeyBinder::Update()
             this->lasyKeyMap = keyMap;
 
             if (this->state.Matches(&UIKeyBinder::State_Selected)) {
-                LogHelpers::Print("bind = %d 0x%02x", keyMap, keyMap);
+                LOG_PRINT("bind = %d 0x%02x", keyMap, keyMap);
 
                 sVars->isSelected   = false;
                 parent->selectionDisabled = false;
@@ -110,7 +110,7 @@ void UIKeyBinder::Update()
             }
         }
         else {
-            LogHelpers::Print("bind = %d 0x%02x", keyMap, keyMap);
+            LOG_PRINT("bind = %d 0x%02x", keyMap, keyMap);
 
             int32 frame = UIButtonPrompt::MappingsToFrame(this->lasyKeyMap);
             this->keyAnimator.SetAnimation(sVars->aniFrames, UIKeyBinder::GetButtonListID(), true, frame);
@@ -6,6 +6,7 @@
 
 #include "S2M.hpp"
 #include "UIPicture.hpp"
+#include "Global/Zone.hpp"
 
 using namespace RSDK;
 
@@ -34,8 +35,10 @@ void UIPicture::Create(void *data)
     this->animator.SetAnimation(sVars->aniFrames, this->listID, true, this->frameID);
 
     if (!sceneInfo->inEditor) {
-        if (Stage::CheckSceneFolder("Menu") || Stage::CheckSceneFolder("LSelect") || Stage::CheckSceneFolder("LSelect2")  || Stage::CheckSceneFolder("LSelectEx") 
-            || Stage::CheckSceneFolder("Thanks") || Stage::CheckSceneFolder("DAGarden")|| Stage::CheckSceneFolder("Continue") || Stage::CheckSceneFolder("Credits")) {
+        uint8 folder = Zone::SceneFolder();
+        if (folder == SceneIdentity::FolderMenu || folder == SceneIdentity::FolderLSelect || folder == SceneIdentity::FolderLSelect2
+            || folder == SceneIdentity::FolderLSelectEx || folder == SceneIdentity::FolderThanks || folder == SceneIdentity::FolderDAGarden
+            || folder == SceneIdentity::FolderContinue || folder == SceneIdentity::FolderCredits) {
             this->active    = ACTIVE_NORMAL;
             this->visible   = true;
             this->drawGroup = 2;
@@ -45,7 +48,7 @@ void UIPicture::Create(void *data)
             }
         }
         else {
-            if (Stage::CheckSceneFolder("Logos") || Stage::CheckSceneFolder("Summary"))
+            if (folder == SceneIdentity::FolderLogos || folder == SceneIdentity::FolderSummary)
                 this->active = ACTIVE_NORMAL;
             this->visible   = true;
             this->drawGroup = 2;
@@ -55,14 +58,17 @@ void UIPicture::Create(void *data)
 
 void UIPicture::StageLoad()
 {
-    if (Stage::CheckSceneFolder("Menu"))
-        sVars->aniFrames.Load("UI/UIPicture.bin", SCOPE_STAGE);
-    else if (Stage::CheckSceneFolder("Logos"))
-        sVars->aniFrames.Load("Logos/Logos.bin", SCOPE_STAGE);
-    else if (Stage::CheckSceneFolder("Thanks") || Stage::CheckSceneFolder("Continue") || Stage::CheckSceneFolder("Credits"))
-        sVars->aniFrames.Load("LSelect/Icons.bin", SCOPE_STAGE);
-    else if (Stage::CheckSceneFolder("DAGarden"))
-        sVars->aniFrames.Load("Cabaret/Characters.bin", SCOPE_STAGE);
+    switch (Zone::SceneFolder()) {
+        default: break;
+        case SceneIdentity::FolderMenu: sVars->aniFrames.Load("UI/UIPicture.bin", SCOPE_STAGE); break;
+        case SceneIdentity::FolderLogos: sVars->aniFrames.Load("Logos/Logos.bin", SCOPE_STAGE); break;
+
+        case SceneIdentity::FolderThanks:
+        case SceneIdentity::FolderContinue:
+        case SceneIdentity::FolderCredits: sVars->aniFrames.Load("LSelect/Icons.bin", SCOPE_STAGE); break;
+
+        case SceneIdentity::FolderDAGarden: sVars->aniFrames.Load("Cabaret/Characters.bin", SCOPE_STAGE); break;
+    }
 }
 
 #if RETRO_INCLUDE_EDITOR
@@ -74,11 +80,11 @@ void UIPicture::EditorDraw()
 
 void UIPicture::EditorLoad()
 {
-    if (Stage::CheckSceneFolder("Menu"))
+    if (Zone::SceneFolder() == SceneIdentity::FolderMenu)
         sVars->aniFrames.Load("UI/UIPicture.bin", SCOPE_STAGE);
-    else if (Stage::CheckSceneFolder("Logos"))
+    else if (Zone::SceneFolder() == SceneIdentity::FolderLogos)
         sVars->aniFrames.Load("Logos/Logos.bin", SCOPE_STAGE);
-    else if (Stage::CheckSceneFolder("Thanks"))
+    else if (Zone::SceneFolder() == SceneIdentity::FolderThanks)
         sVars->aniFrames.Load("LSelect/Icons.bin", SCOPE_STAGE);
 }
 #endif
@@ -51,13 +51,13 @@ void UIPopover::StageLoad()
 UIPopover *UIPopover::CreatePopover()
 {
     if (sVars->activePopover) {
-        LogHelpers::Print("EXCEPTION: Called CreatePopover when an activePopover already existed.");
+        LOG_PRINT("EXCEPTION: Called CreatePopover when an activePopover already existed.");
         return nullptr;
     }
     else {
         if (GameObject::Get<UIPopover>(SLOT_POPOVER)->classID) {
-            LogHelpers::Print("Can't create UIPopover (%d), entity already exists in slot (class ID: %d)", sVars->classID,
-                             GameObject::Get<UIPopover>(SLOT_POPOVER)->classID);
+            LOG_PRINT("Can't create UIPopover (%d), entity already exists in slot (class ID: %d)", sVars->classID,
+                      GameObject::Get<UIPopover>(SLOT_POPOVER)->classID);
             return nullptr;
         }
         else {
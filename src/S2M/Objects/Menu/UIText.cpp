@@ -5,6 +5,7 @@
 // ---------------------------------------------------------------------
 
 #include "UIText.hpp"
+#include "Global/Zone.hpp"
 #include "UIWidgets.hpp"
 #include "UIButton.hpp"
 
@@ -73,7 +74,7 @@ void UIText::Create(void *data)
 
 void UIText::StageLoad()
 {
-    if (Stage::CheckSceneFolder("Credits")) {
+    if (Zone::SceneFolder() == SceneIdentity::FolderCredits) {
         sVars->aniFrames.Load("LSelect/Text.bin", SCOPE_STAGE);
     }
 }
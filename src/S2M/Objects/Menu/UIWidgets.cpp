@@ -5,6 +5,7 @@
 // ---------------------------------------------------------------------
 
 #include "UIWidgets.hpp"
+#include "Global/Zone.hpp"
 #include "Helpers/LogHelpers.hpp"
 #include "Global/Localization.hpp"
 
@@ -47,7 +48,7 @@ void UIWidgets::StageLoad()
 
     // these should only load in the main menu (this saves on stage space so we dont have a bunch of unneccessary textures loaded which could
     // negatively affect stuff later maybe idk)
-    if (Stage::CheckSceneFolder("Menu")) {
+    if (Zone::SceneFolder() == SceneIdentity::FolderMenu) {
         sVars->buttonFrames.Load("UI/UIButtons.bin", SCOPE_STAGE);
         sVars->descFrames.Load("UI/DescriptionText.bin", SCOPE_STAGE);
         sVars->timeAttackFrames.Load("UI/TimeAttack.bin", SCOPE_STAGE);
@@ -85,7 +86,7 @@ void UIWidgets::StageLoad()
 
 void UIWidgets::ApplyLanguage()
 {
-    LogHelpers::Print("Apply Language %d", Localization::sVars->language);
+    LOG_PRINT("Apply Language %d", Localization::sVars->language);
 
     switch (Localization::sVars->language) {
         case LANGUAGE_EN: sVars->textFrames.Load("UI/TextEN.bin", SCOPE_STAGE); break;
@@ -11,6 +11,7 @@
 #include "Common/Button.hpp"
 #include "Helpers/MathHelpers.hpp"
 #include "Helpers/DrawHelpers.hpp"
+#include "Helpers/LogHelpers.hpp"
 
 using namespace RSDK;
 
@@ -38,72 +39,73 @@ void Fan::StaticUpdate()
         int32 offsetH = 0;
         int32 offsetV = 0;
 
-        for (auto water : GameObject::GetEntities<Water>(FOR_ACTIVE_ENTITIES))
-        {
-            if (water->state.Matches(&Water::BubbleFinishPopBehavior) && water->activePlayers) {
-                for (auto fan : GameObject::GetEntities<Fan>(FOR_ACTIVE_ENTITIES))
-                {
-                    sVars->hitboxTop.top = (Math::Sin256(2 * Zone::sVars->timer) >> 5) - fan->size;
-                    if (fan->state.Matches(&Fan::HandlePlayerInteractions_Top)) {
-                        if (MathHelpers::PointInHitbox(fan->position.x, fan->position.y, water->position.x, water->position.y, fan->direction,
-                                                      &sVars->hitboxTop)) {
-                            offsetV -= 0x20000;
-                        }
-                    }
+        // offsetH/offsetV carry over from one bubble to the next, the registry is already in slot order so that's kept
+        Water *bubbles[FAN_BUBBLE_COUNT];
+        int32 bubbleCount = 0;
+        for (int32 i = 0; i < Water::sVars->registryCount[Water::RegistryBubbles]; ++i) {
+            Water *water = Water::GetRegistered(Water::RegistryBubbles, i, true);
+            if (water && water->state.Matches(&Water::BubbleFinishPopBehavior) && water->activePlayers) {
+                if (bubbleCount >= FAN_BUBBLE_COUNT) {
+                    LOG_PRINT("Fan: more than %d bubbles are holding players, skipping the rest", FAN_BUBBLE_COUNT);
+                    break;
+                }
 
-                    sVars->hitboxBottom.top = (Math::Sin256(2 * Zone::sVars->timer) >> 5) - fan->size;
-                    if (fan->state.Matches(&Fan::HandlePlayerInteractions_Bottom)) {
-                        if (MathHelpers::PointInHitbox(fan->position.x, fan->position.y, water->position.x, water->position.y, fan->direction,
-                                                      &sVars->hitboxBottom)) {
-                            offsetV += 0x20000;
-                        }
-                    }
+                bubbles[bubbleCount++] = water;
+            }
+        }
 
-                    sVars->hitboxSides.left = (Math::Sin256(2 * Zone::sVars->timer) >> 5) - fan->size;
-                    if (fan->state.Matches(&Fan::HandlePlayerInteractions_Left)) {
-                        if (MathHelpers::PointInHitbox(fan->position.x, fan->position.y, water->position.x, water->position.y, fan->direction,
-                                                      &sVars->hitboxSides)) {
-                            offsetH -= 0x20000;
-                        }
-                    }
-                    if (fan->state.Matches(&Fan::HandlePlayerInteractions_Right)) {
-                        if (MathHelpers::PointInHitbox(fan->position.x, fan->position.y, water->position.x, water->position.y, fan->direction,
-                                                      &sVars->hitboxSides)) {
-                            offsetH += 0x20000;
-                        }
+        if (bubbleCount)
+            SetupInfluenceVolumes();
+
+        for (int32 b = 0; b < bubbleCount; ++b) {
+            Water *water = bubbles[b];
+
+            int32 cellX = -1;
+            int32 cellY = -1;
+            if (sVars->volumeCount)
+                GetInfluenceGridCell(water->position.x, water->position.y, &cellX, &cellY);
+
+            if (cellX >= 0 && cellY >= 0) {
+                int32 cell = cellX + cellY * FAN_GRID_SIZE;
+                for (int32 v = sVars->gridStart[cell]; v < sVars->gridStart[cell + 1]; ++v) {
+                    InfluenceVolume *volume = &sVars->volumes[sVars->gridVolumes[v]];
+                    if (water->position.x >= volume->left && water->position.x <= volume->right && water->position.y >= volume->top
+                        && water->position.y <= volume->bottom) {
+                        offsetH += volume->offsetH;
+                        offsetV += volume->offsetV;
                     }
                 }
+            }
 
-                offsetH = CLAMP(offsetH, -0x20000, 0x20000);
-                offsetV = CLAMP(offsetV, -0x20000, 0x20000);
+            offsetH = CLAMP(offsetH, -0x20000, 0x20000);
+            offsetV = CLAMP(offsetV, -0x20000, 0x20000);
 
-                if (water->bubbleOffset.x < offsetH) {
-                    water->bubbleOffset.x += 0x800;
+            if (water->bubbleOffset.x < offsetH) {
+                water->bubbleOffset.x += 0x800;
 
-                    if (water->bubbleOffset.x > offsetH)
-                        water->bubbleOffset.x = offsetH;
-                }
+                if (water->bubbleOffset.x > offsetH)
+                    water->bubbleOffset.x = offsetH;
+            }
 
-                if (water->bubbleOffset.x > offsetH) {
-                    water->bubbleOffset.x -= 0x800;
+            if (water->bubbleOffset.x > offsetH) {
+                water->bubbleOffset.x -= 0x800;
 
-                    if (water->bubbleOffset.x < offsetH)
-                        water->bubbleOffset.x = offsetH;
-                }
+                if (water->bubbleOffset.x < offsetH)
+                    water->bubbleOffset.x = offsetH;
+            }
 
-                if (water->bubbleOffset.y < offsetV) {
-                    water->bubbleOffset.y += 0x800;
+            if (water->bubbleOffset.y < offsetV) {
+                water->bubbleOffset.y += 0x800;
 
-                    if (water->bubbleOffset.y > offsetV)
-                        water->bubbleOffset.y = offsetV;
-                }
+                if (water->bubbleOffset.y > offsetV)
+                    water->bubbleOffset.y = offsetV;
+            }
 
-                if (water->bubbleOffset.y > offsetV) {
-                    water->bubbleOffset.y -= 0x800;
+            if (water->bubbleOffset.y > offsetV) {
+                water->bubbleOffset.y -= 0x800;
 
-                    if (water->bubbleOffset.y < offsetV)
-                        water->bubbleOffset.y = offsetV;
-                }
+                if (water->bubbleOffset.y < offsetV)
+                    water->bubbleOffset.y = offsetV;
             }
         }
     }
@@ -219,6 +221,126 @@ void Fan::SetupTagLink()
     }
 }
 
+void Fan::SetupInfluenceVolumes()
+{
+    int32 wave         = Math::Sin256(2 * Zone::sVars->timer) >> 5;
+    int32 lastSize     = 0;
+    bool32 foundFan    = false;
+    sVars->volumeCount = 0;
+
+    for (auto fan : GameObject::GetEntities<Fan>(FOR_ACTIVE_ENTITIES)) {
+        foundFan = true;
+        lastSize = fan->size;
+
+        if (sVars->volumeCount >= FAN_VOLUME_COUNT) {
+            LOG_PRINT("Fan: more than %d active fans, fan in slot %d has no influence volume", FAN_VOLUME_COUNT, fan->Slot());
+            continue;
+        }
+
+        Hitbox hitbox;
+        int32 pushH = 0;
+        int32 pushV = 0;
+        if (fan->state.Matches(&Fan::HandlePlayerInteractions_Top)) {
+            hitbox     = sVars->hitboxTop;
+            hitbox.top = wave - fan->size;
+            pushV      = -0x20000;
+        }
+        else if (fan->state.Matches(&Fan::HandlePlayerInteractions_Bottom)) {
+            hitbox     = sVars->hitboxBottom;
+            hitbox.top = wave - fan->size;
+            pushV      = 0x20000;
+        }
+        else if (fan->state.Matches(&Fan::HandlePlayerInteractions_Left)) {
+            hitbox      = sVars->hitboxSides;
+            hitbox.left = wave - fan->size;
+            pushH       = -0x20000;
+        }
+        else if (fan->state.Matches(&Fan::HandlePlayerInteractions_Right)) {
+            hitbox      = sVars->hitboxSides;
+            hitbox.left = wave - fan->size;
+            pushH       = 0x20000;
+        }
+        else {
+            continue;
+        }
+
+        // same box MathHelpers::PointInHitbox builds
+        int32 left   = (fan->direction & FLIP_X) ? -hitbox.left : hitbox.left;
+        int32 right  = (fan->direction & FLIP_X) ? -hitbox.right : hitbox.right;
+        int32 top    = (fan->direction & FLIP_Y) ? -hitbox.top : hitbox.top;
+        int32 bottom = (fan->direction & FLIP_Y) ? -hitbox.bottom : hitbox.bottom;
+
+        InfluenceVolume *volume = &sVars->volumes[sVars->volumeCount++];
+        volume->left            = fan->position.x + (MIN(left, right) << 16);
+        volume->right           = fan->position.x + (MAX(left, right) << 16);
+        volume->top             = fan->position.y + (MIN(top, bottom) << 16);
+        volume->bottom          = fan->position.y + (MAX(top, bottom) << 16);
+        volume->offsetH         = pushH;
+        volume->offsetV         = pushV;
+    }
+
+    // the per-pair loop this replaces left these behind, and HandlePlayerInteractions_Bottom still reads hitboxBottom.top
+    if (foundFan) {
+        sVars->hitboxTop.top    = wave - lastSize;
+        sVars->hitboxBottom.top = wave - lastSize;
+        sVars->hitboxSides.left = wave - lastSize;
+    }
+
+    if (!sVars->volumeCount)
+        return;
+
+    int32 minX = sVars->volumes[0].left;
+    int32 minY = sVars->volumes[0].top;
+    int32 maxX = sVars->volumes[0].right;
+    int32 maxY = sVars->volumes[0].bottom;
+    for (int32 v = 1; v < sVars->volumeCount; ++v) {
+        minX = MIN(minX, sVars->volumes[v].left);
+        minY = MIN(minY, sVars->volumes[v].top);
+        maxX = MAX(maxX, sVars->volumes[v].right);
+        maxY = MAX(maxY, sVars->volumes[v].bottom);
+    }
+
+    sVars->gridOrigin.x   = minX;
+    sVars->gridOrigin.y   = minY;
+    sVars->gridCellSize.x = (int32)(((int64)maxX - minX) / FAN_GRID_SIZE + 1);
+    sVars->gridCellSize.y = (int32)(((int64)maxY - minY) / FAN_GRID_SIZE + 1);
+
+    // bucket each volume into every cell it overlaps
+    memset(sVars->gridStart, 0, sizeof(sVars->gridStart));
+    for (int32 pass = 0; pass < 2; ++pass) {
+        uint16 cursor[FAN_GRID_SIZE * FAN_GRID_SIZE];
+        if (pass) {
+            for (int32 c = 1; c <= FAN_GRID_SIZE * FAN_GRID_SIZE; ++c) sVars->gridStart[c] += sVars->gridStart[c - 1];
+            memcpy(cursor, sVars->gridStart, sizeof(cursor));
+        }
+
+        for (int32 v = 0; v < sVars->volumeCount; ++v) {
+            int32 cellL, cellT, cellR, cellB;
+            GetInfluenceGridCell(sVars->volumes[v].left, sVars->volumes[v].top, &cellL, &cellT);
+            GetInfluenceGridCell(sVars->volumes[v].right, sVars->volumes[v].bottom, &cellR, &cellB);
+
+            for (int32 y = cellT; y <= cellB; ++y) {
+                for (int32 x = cellL; x <= cellR; ++x) {
+                    int32 cell = x + y * FAN_GRID_SIZE;
+                    if (pass)
+                        sVars->gridVolumes[cursor[cell]++] = v;
+                    else
+                        sVars->gridStart[cell + 1]++;
+                }
+            }
+        }
+    }
+}
+
+void Fan::GetInfluenceGridCell(int32 x, int32 y, int32 *cellX, int32 *cellY)
+{
+    int64 gridX = ((int64)x - sVars->gridOrigin.x) / sVars->gridCellSize.x;
+    int64 gridY = ((int64)y - sVars->gridOrigin.y) / sVars->gridCellSize.y;
+
+    *cellX = x >= sVars->gridOrigin.x && gridX < FAN_GRID_SIZE ? (int32)gridX : -1;
+    *cellY = y >= sVars->gridOrigin.y && gridY < FAN_GRID_SIZE ? (int32)gridY : -1;
+}
+
 void Fan::HandlePlayerInteractions_Top()
 {
     sVars->hitboxTop.top    = (Math::Sin256(2 * Zone::sVars->timer) >> 5) - this->size;
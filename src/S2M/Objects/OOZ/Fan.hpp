@@ -1,6 +1,11 @@
 #pragma once
 #include "S2M.hpp"
 
+#define FAN_VOLUME_COUNT (0x100)
+#define FAN_GRID_SIZE    (8)
+// a carrying bubble always holds at least one player
+#define FAN_BUBBLE_COUNT (PLAYER_COUNT * 4)
+
 namespace GameLogic
 {
 
@@ -33,6 +38,16 @@ struct Fan : RSDK::GameObject::Entity {
     // STRUCTS
     // ==============================
 
+    // world-space box a fan pushes carrying bubbles inside, resolved once per frame
+    struct InfluenceVolume {
+        int32 left;
+        int32 top;
+        int32 right;
+        int32 bottom;
+        int32 offsetH;
+        int32 offsetV;
+    };
+
     // ==============================
     // STATIC VARS
     // ==============================
@@ -48,6 +63,12 @@ struct Fan : RSDK::GameObject::Entity {
         RSDK::SpriteAnimation aniFrames;
         RSDK::SoundFX sfxFan;
         bool32 playingFanSfx;
+        InfluenceVolume volumes[FAN_VOLUME_COUNT];
+        int32 volumeCount;
+        RSDK::Vector2 gridOrigin;
+        RSDK::Vector2 gridCellSize;
+        uint16 gridStart[FAN_GRID_SIZE * FAN_GRID_SIZE + 1];
+        uint8 gridVolumes[FAN_VOLUME_COUNT * FAN_GRID_SIZE * FAN_GRID_SIZE];
     };
 
     // ==============================
@@ -92,6 +113,8 @@ struct Fan : RSDK::GameObject::Entity {
     // ==============================
 
     void SetupTagLink();
+    static void SetupInfluenceVolumes();
+    static void GetInfluenceGridCell(int32 x, int32 y, int32 *cellX, int32 *cellY);
 
     void HandlePlayerInteractions_Top();
     void HandlePlayerInteractions_Bottom();
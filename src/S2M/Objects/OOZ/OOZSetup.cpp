@@ -256,7 +256,7 @@ void OOZSetup::StageLoad()
     sVars->splashFrames.Load("OOZ/Splash.bin", SCOPE_STAGE);
     sVars->animator.SetAnimation(sVars->splashFrames, 0, true, 0);
 
-    if (Stage::CheckSceneFolder("OOZ")) {
+    if (Zone::SceneFolder() == SceneIdentity::FolderOOZ) {
         if (globals->gameMode != MODE_TIMEATTACK) {
             const char *playingAsText  = "";
             const char *characterImage = "";
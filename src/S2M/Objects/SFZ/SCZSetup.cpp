@@ -48,10 +48,10 @@ void SCZSetup::StageLoad()
                 characterText  = "Knuckles";
                 break;
         }
-        if (Stage::CheckSceneFolder("SCZ")) {
+        if (Zone::SceneFolder() == SceneIdentity::FolderSCZ) {
             SetPresence(playingAsText, "In Sky Chase", "sfz", "Sky Chase", characterImage, characterText);
         }
-        else if (Stage::CheckSceneFolder("WFZ")) {
+        else if (Zone::SceneFolder() == SceneIdentity::FolderWFZ) {
             SetPresence(playingAsText, "In Wing Fortress", "sfz", "Wing Fortress", characterImage, characterText);
         }
     }
@@ -9,6 +9,7 @@
 #include "Global/Zone.hpp"
 #include "Global/DebugMode.hpp"
 #include "Global/Explosion.hpp"
+#include "Helpers/BadnikHelpers.hpp"
 
 using namespace RSDK;
 
@@ -16,6 +17,13 @@ namespace GameLogic
 {
 RSDK_REGISTER_OBJECT(Bomb);
 
+static const BadnikHelpers::BurstPiece shrapnelBurst[] = {
+    { 0, 0, -0x20000, -0x30000 },
+    { 0, 0, -0x10000, -0x20000 },
+    { 0, 0, 0x20000, -0x30000 },
+    { 0, 0, 0x10000, -0x20000 },
+};
+
 void Bomb::Update() { this->state.Run(this); }
 
 void Bomb::LateUpdate() {}
@@ -192,29 +200,12 @@ void Bomb::State_Explode()
     }
     else {
         sVars->sfxExplosion.Play(false, 255);
-        Bomb *debris        = GameObject::Create<Bomb>(INT_TO_VOID(true), this->position.x, this->position.y);
-        debris->velocity.x  = -0x20000;
-        debris->velocity.y  = -0x30000;
-        debris->planeFilter = this->planeFilter;
-        debris->drawGroup   = this->drawGroup;
-
-        debris              = GameObject::Create<Bomb>(INT_TO_VOID(true), this->position.x, this->position.y);
-        debris->velocity.x  = -0x10000;
-        debris->velocity.y  = -0x20000;
-        debris->planeFilter = this->planeFilter;
-        debris->drawGroup   = this->drawGroup;
-
-        debris              = GameObject::Create<Bomb>(INT_TO_VOID(true), this->position.x, this->position.y);
-        debris->velocity.x  = 0x20000;
-        debris->velocity.y  = -0x30000;
-        debris->planeFilter = this->planeFilter;
-        debris->drawGroup   = this->drawGroup;
-
-        debris              = GameObject::Create<Bomb>(INT_TO_VOID(true), this->position.x, this->position.y);
-        debris->velocity.x  = 0x10000;
-        debris->velocity.y  = -0x20000;
-        debris->planeFilter = this->planeFilter;
-        debris->drawGroup   = this->drawGroup;
+        Bomb *debris[4];
+        BadnikHelpers::SpawnBurst<Bomb>(INT_TO_VOID(true), this->position.x, this->position.y, shrapnelBurst, 4, debris);
+        for (int32 d = 0; d < 4; ++d) {
+            debris[d]->planeFilter = this->planeFilter;
+            debris[d]->drawGroup   = this->drawGroup;
+        }
 
         Explosion *explosion       = GameObject::Create<Explosion>(INT_TO_VOID(Explosion::Type1), this->position.x, this->position.y);
         explosion->planeFilter     = this->planeFilter;
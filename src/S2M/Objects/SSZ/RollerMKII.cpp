@@ -13,6 +13,7 @@
 #include "Global/Spikes.hpp"
 #include "Common/Platform.hpp"
 #include "Common/BreakableWall.hpp"
+#include "Helpers/SolidIndex.hpp"
 
 using namespace RSDK;
 
@@ -235,15 +236,27 @@ bool32 RollerMKII::HandlePlatformCollisions(Platform *platform)
 
 void RollerMKII::HandleCollisions()
 {
-    for (auto planeSwitch : GameObject::GetEntities<PlaneSwitch>(FOR_ALL_ENTITIES))
-    {
+    SolidIndex::SolidHit solids[SOLIDINDEX_QUERY_COUNT];
+    uint8 solidTypes = (1 << SolidIndex::SolidPlaneSwitch) | (1 << SolidIndex::SolidSpikes) | (1 << SolidIndex::SolidBreakableWall);
+    int32 solidCount = SolidIndex::QueryHitbox(this, &sVars->hitboxObject, solidTypes, false, solids, SOLIDINDEX_QUERY_COUNT);
+
+    // hits come back grouped by type, so plane switches are all at the front
+    int32 s = 0;
+    for (; s < solidCount && solids[s].type == SolidIndex::SolidPlaneSwitch; ++s) {
+        PlaneSwitch *planeSwitch = (PlaneSwitch *)solids[s].entity;
         planeSwitch->CheckCollisions(this, planeSwitch->flags, planeSwitch->size, true, Zone::sVars->playerDrawGroup[0],
-                                    Zone::sVars->playerDrawGroup[1]);
+                                     Zone::sVars->playerDrawGroup[1]);
     }
 
+    // every platform has to be visited, not just nearby ones, since this also puts each one's position back to its centerPos
     for (auto platform : GameObject::GetEntities<Platform>(FOR_ALL_ENTITIES)) { RollerMKII::HandlePlatformCollisions(platform); }
-    for (auto spikes : GameObject::GetEntities<Spikes>(FOR_ALL_ENTITIES)) { RollerMKII::HandleObjectCollisions((Entity *)spikes, &spikes->hitbox); }
-    for (auto wall : GameObject::GetEntities<BreakableWall>(FOR_ALL_ENTITIES)) { RollerMKII::HandleObjectCollisions((Entity *)wall, &wall->hitbox); }
+
+    for (; s < solidCount; ++s) {
+        if (solids[s].type == SolidIndex::SolidSpikes)
+            RollerMKII::HandleObjectCollisions(solids[s].entity, &((Spikes *)solids[s].entity)->hitbox);
+        else
+            RollerMKII::HandleObjectCollisions(solids[s].entity, &((BreakableWall *)solids[s].entity)->hitbox);
+    }
 
     if (!this->collisionMode && !this->state.Matches(&RollerMKII::State_Bumped)) {
         bool32 collided = this->direction == FLIP_X
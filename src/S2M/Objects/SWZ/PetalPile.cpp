@@ -167,7 +167,7 @@ void PetalPile::State_HandleInteractions()
 
 void PetalPile::State_SetupEmitter()
 {
-    Vector2 pattern[0x100];
+    Vector2 pattern[PETALPILE_LEAF_COUNT];
     memset(pattern, 0, sizeof(pattern));
     int32 count = PetalPile::GetLeafPattern(pattern);
 
@@ -192,29 +192,37 @@ void PetalPile::State_SetupEmitter()
     int32 pos = 0;
     for (int32 i = 0; i < count; ++i) pos = MAX(pos, abs((this->position.x - offsetX) + pattern[i].x));
 
-    for (int32 i = 0; i < count; ++i) {
-        int32 spawnX = pattern[i].x + this->position.x;
-        int32 spawnY = pattern[i].y + this->position.y;
-
-        int32 angle            = Math::ATan2(spawnX - offsetX, spawnY - offsetY);
-        PetalPile *petal       = GameObject::Create<PetalPile>(this, spawnX, spawnY);
-        petal->state.Set(&PetalPile::StateLeaf_Setup);
-        petal->stateDraw.Set(&PetalPile::Draw_Leaf);
-
-        int32 radius = this->petalRadius >> 1;
-        if (this->petalDir) {
-            petal->direction = this->petalDir <= 0;
-            petal->petalVel  = this->petalVel;
-            radius           = (this->petalRadius >> 8) * ((16 * (abs(spawnX - offsetX) / (pos >> 16))) >> 12);
-            petal->timer     = (pos - abs(spawnX - offsetX)) >> 18;
-        }
-        else {
-            petal->direction = ZONE_RAND(FLIP_NONE, FLIP_X);
-        }
+    if (count) {
+        PetalPile *leaves = GameObject::Create<PetalPile>(this, this->position.x, this->position.y);
+        leaves->state.Set(&PetalPile::StateLeaf_Setup);
+        leaves->stateDraw.Set(&PetalPile::Draw_Leaf);
+        leaves->drawGroup = this->tileLayer ? Zone::sVars->objectDrawGroup[0] : Zone::sVars->objectDrawGroup[1];
+        leaves->leafCount = count;
+
+        for (int32 i = 0; i < count; ++i) {
+            int32 spawnX = pattern[i].x + this->position.x;
+            int32 spawnY = pattern[i].y + this->position.y;
+
+            int32 angle         = Math::ATan2(spawnX - offsetX, spawnY - offsetY);
+            leaves->leafPosX[i] = spawnX;
+            leaves->leafPosY[i] = spawnY;
+
+            int32 radius = this->petalRadius >> 1;
+            if (this->petalDir) {
+                leaves->leafDirection[i] = this->petalDir <= 0;
+                leaves->leafPetalVel[i]  = this->petalVel;
+                radius                   = (this->petalRadius >> 8) * ((16 * (abs(spawnX - offsetX) / (pos >> 16))) >> 12);
+                leaves->leafTimer[i]     = (pos - abs(spawnX - offsetX)) >> 18;
+            }
+            else {
+                leaves->leafDirection[i] = ZONE_RAND(FLIP_NONE, FLIP_X);
+            }
 
-        petal->velStore.x = (radius >> 8) * Math::Cos256(angle);
-        petal->velStore.y = (radius >> 9) * Math::Sin256(angle) - 0x20000;
-        petal->drawGroup  = this->tileLayer ? Zone::sVars->objectDrawGroup[0] : Zone::sVars->objectDrawGroup[1];
+            // leaves don't move while they're delayed, so their launch velocity can wait in here until then
+            leaves->leafVelX[i]  = (radius >> 8) * Math::Cos256(angle);
+            leaves->leafVelY[i]  = (radius >> 9) * Math::Sin256(angle) - 0x20000;
+            leaves->leafState[i] = PETALPILE_LEAF_DELAY;
+        }
     }
 
     if (this->emitterMode) {
@@ -227,13 +235,7 @@ void PetalPile::State_SetupEmitter()
             int32 top    = (this->position.y >> 16) + this->hitbox.top;
             int32 bottom = (this->position.y >> 16) + this->hitbox.bottom;
 
-            int32 sizeX = (right >> 4) - (left >> 4);
-            int32 sizeY = (bottom >> 4) - (top >> 4);
-            for (int32 x = 0; x <= sizeX; ++x) {
-                for (int32 y = 0; y <= sizeY; ++y) {
-                    RSDKTable->SetTile(this->layerID, x + (left >> 4), y + (top >> 4), -1);
-                }
-            }
+            Zone::FillTiles(this->layerID, left >> 4, top >> 4, (right >> 4) - (left >> 4) + 1, (bottom >> 4) - (top >> 4) + 1, -1);
         }
 
         this->Destroy();
@@ -255,118 +257,113 @@ void PetalPile::State_Emitter()
 
 void PetalPile::StateLeaf_Setup()
 {
-    this->hitbox.left   = -1;
-    this->hitbox.top    = -1;
-    this->hitbox.right  = 1;
-    this->hitbox.bottom = 1;
-
     this->active        = ACTIVE_NORMAL;
     this->updateRange.x = 0x10000;
     this->updateRange.y = 0x10000;
     this->animator.SetAnimation(sVars->aniFrames, 0, true, 0);
 
-    this->state.Set(&PetalPile::StateLeaf_Delay);
-    PetalPile::StateLeaf_Delay();
+    this->state.Set(&PetalPile::StateLeaf_Update);
+    PetalPile::StateLeaf_Update();
 }
 
-void PetalPile::StateLeaf_Delay()
+void PetalPile::StateLeaf_Update()
 {
-    if (this->timer <= 0) {
-        this->state.Set(&PetalPile::StateLeaf_HandleVelocity);
-        this->timer    = 0;
-        this->velocity = this->velStore;
-    }
-    else {
-        this->timer--;
-    }
-
-    if (!this->CheckOnScreen(&this->updateRange))
-        this->Destroy();
-}
-
-void PetalPile::StateLeaf_HandleVelocity()
-{
-    if (this->petalVel > 0) {
-        this->petalVel -= 4096;
-        if (this->petalVel < 0)
-            this->petalVel = 0;
-    }
-    else if (this->petalVel < 0) {
-        this->petalVel += 0x1000;
-        if (this->petalVel > 0)
-            this->petalVel = 0;
-    }
+    Vector2 storePos = this->position;
+    int32 leavesLeft = 0;
+
+    // leaves are handled in the same order their entities used to be, so they still pull from the zone rng in the same order too
+    for (int32 i = 0; i < this->leafCount; ++i) {
+        uint8 leafState = this->leafState[i];
+        if (leafState == PETALPILE_LEAF_GONE)
+            continue;
+
+        if (leafState == PETALPILE_LEAF_DELAY) {
+            if (!this->leafTimer[i])
+                this->leafState[i] = PETALPILE_LEAF_RISE;
+            else
+                this->leafTimer[i]--;
+        }
+        else {
+            int32 petalVel = this->leafPetalVel[i];
+            if (petalVel > 0)
+                petalVel = MAX(petalVel - 0x1000, 0);
+            else if (petalVel < 0)
+                petalVel = MIN(petalVel + 0x1000, 0);
+            this->leafPetalVel[i] = petalVel;
+
+            int32 velX = this->leafVelX[i];
+            int32 velY = this->leafVelY[i] + 0x4000;
+            if (leafState == PETALPILE_LEAF_RISE) {
+                if (velX <= 0)
+                    velX += MIN(abs(velX), 0x8000);
+                else
+                    velX -= MIN(abs(velX), 0x8000);
+
+                if (velY > 0)
+                    velY = 0;
+            }
+            else {
+                if (velY > 0x10000)
+                    velY = 0x10000;
 
-    this->position.x += this->petalVel;
+                velX = Math::Sin256(4 * this->leafOffset[i]) << 8;
+            }
 
-    if (this->velocity.x <= 0)
-        this->velocity.x += MIN(abs(this->velocity.x), 0x8000);
-    else
-        this->velocity.x -= MIN(abs(this->velocity.x), 0x8000);
-    this->velocity.y += 0x4000;
+            this->leafVelX[i] = velX;
+            this->leafVelY[i] = velY;
+            this->leafPosX[i] += petalVel + velX;
+            this->leafPosY[i] += velY;
 
-    if (this->velocity.y > 0)
-        this->velocity.y = 0;
+            if (++this->leafTimer[i] > (leafState == PETALPILE_LEAF_RISE ? 2 : 3)) {
+                if (ZONE_RAND(0, 10) > 6)
+                    this->leafDirection[i] = this->leafDirection[i] == FLIP_NONE;
 
-    this->position.x += this->velocity.x;
-    this->position.y += this->velocity.y;
+                this->leafTimer[i] = 0;
+            }
 
-    if (++this->timer > 2) {
-        if (ZONE_RAND(0, 10) > 6)
-            this->direction = this->direction == FLIP_NONE;
+            if (leafState == PETALPILE_LEAF_RISE) {
+                if (velY >= 0 && !velX) {
+                    this->leafOffset[i] = ZONE_RAND(0, 255);
+                    this->leafState[i]  = PETALPILE_LEAF_FALL;
+                }
+            }
+            else {
+                this->leafOffset[i]++;
+            }
+        }
 
-        this->timer = 0;
+        this->position.x = this->leafPosX[i];
+        this->position.y = this->leafPosY[i];
+        if (!this->CheckOnScreen(&this->updateRange))
+            this->leafState[i] = PETALPILE_LEAF_GONE;
+        else
+            leavesLeft++;
     }
 
-    if (this->velocity.y >= 0 && !this->velocity.x) {
-        this->petalOffset = ZONE_RAND(0, 255);
-        this->state.Set(&PetalPile::StateLeaf_Fall);
-    }
+    this->position = storePos;
 
-    if (!this->CheckOnScreen(&this->updateRange))
+    if (!leavesLeft)
         this->Destroy();
 }
 
-void PetalPile::StateLeaf_Fall()
+void PetalPile::Draw_Leaf()
 {
-    if (this->petalVel > 0) {
-        this->petalVel -= 4096;
-        if (this->petalVel < 0)
-            this->petalVel = 0;
-    }
-    else if (this->petalVel < 0) {
-        this->petalVel += 0x1000;
-        if (this->petalVel > 0)
-            this->petalVel = 0;
-    }
-
-    this->position.x += this->petalVel;
-
-    this->velocity.y += 0x4000;
-    if (this->velocity.y > 0x10000)
-        this->velocity.y = 0x10000;
+    uint8 storeDir = this->direction;
 
-    this->velocity.x = Math::Sin256(4 * this->petalOffset) << 8;
+    for (int32 i = 0; i < this->leafCount; ++i) {
+        if (this->leafState[i] == PETALPILE_LEAF_GONE)
+            continue;
 
-    this->position.x += this->velocity.x;
-    this->position.y += this->velocity.y;
-
-    ++this->timer;
-    if (this->timer > 3) {
-        if (ZONE_RAND(0, 10) > 6)
-            this->direction = this->direction == FLIP_NONE;
-
-        this->timer = 0;
+        Vector2 drawPos;
+        drawPos.x       = this->leafPosX[i];
+        drawPos.y       = this->leafPosY[i];
+        this->direction = this->leafDirection[i];
+        this->animator.DrawSprite(&drawPos, false);
     }
 
-    if (!this->CheckOnScreen(&this->updateRange))
-        this->Destroy();
-
-    this->petalOffset++;
+    this->direction = storeDir;
 }
 
-void PetalPile::Draw_Leaf() { this->animator.DrawSprite(nullptr, false); }
-
 #if RETRO_REV0U
 void PetalPile::StaticLoad(Static *sVars)
 { 
@@ -1,6 +1,9 @@
 #pragma once
 #include "S2M.hpp"
 
+// the largest leaf pattern
+#define PETALPILE_LEAF_COUNT (10)
+
 namespace GameLogic
 {
 
@@ -23,6 +26,13 @@ struct PetalPile : RSDK::GameObject::Entity {
         PETALPILE_PATTERN_4,
     };
 
+    enum PetalPileLeafStates {
+        PETALPILE_LEAF_DELAY,
+        PETALPILE_LEAF_RISE,
+        PETALPILE_LEAF_FALL,
+        PETALPILE_LEAF_GONE,
+    };
+
     // ==============================
     // STRUCTS
     // ==============================
@@ -55,16 +65,25 @@ struct PetalPile : RSDK::GameObject::Entity {
     RSDK::Vector2 maxSpeed;
     bool32 emitterMode;
     uint8 layerID;
-    RSDK::Vector2 velStore;
     RSDK::Vector2 distance; // dunno if this is actually a vec2 but the .y is always set to 0 so maybe?
     int32 petalVel;
     int32 unused;
     int8 petalDir;
     int32 petalRadius;
-    int32 petalOffset;
     bool32 noRemoveTiles;
     RSDK::Hitbox hitbox;
     RSDK::Animator animator;
+    // every leaf from one burst lives in a single entity, these are only used by that one
+    int32 leafCount;
+    int32 leafPosX[PETALPILE_LEAF_COUNT];
+    int32 leafPosY[PETALPILE_LEAF_COUNT];
+    int32 leafVelX[PETALPILE_LEAF_COUNT];
+    int32 leafVelY[PETALPILE_LEAF_COUNT];
+    int32 leafPetalVel[PETALPILE_LEAF_COUNT];
+    uint16 leafTimer[PETALPILE_LEAF_COUNT];
+    uint8 leafDirection[PETALPILE_LEAF_COUNT];
+    uint8 leafOffset[PETALPILE_LEAF_COUNT];
+    uint8 leafState[PETALPILE_LEAF_COUNT];
 
     // ==============================
     // EVENTS
@@ -99,9 +118,7 @@ struct PetalPile : RSDK::GameObject::Entity {
     void State_Emitter();
 
     void StateLeaf_Setup();
-    void StateLeaf_Delay();
-    void StateLeaf_HandleVelocity();
-    void StateLeaf_Fall();
+    void StateLeaf_Update();
 
     void Draw_Leaf();
 
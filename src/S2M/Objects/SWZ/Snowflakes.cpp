@@ -189,11 +189,11 @@ void Snowflakes::Create(void *data)
 
 void Snowflakes::StageLoad()
 {
-    if (Stage::CheckSceneFolder("SWZ")) {
+    if (Zone::SceneFolder() == SceneIdentity::FolderSWZ) {
         sVars->aniFrames.Load("SWZ/Leaves.bin", SCOPE_STAGE);
         sVars->holiday = false;
     }
-    else if (Stage::CheckSceneFolder("HEHZ")) {
+    else if (Zone::SceneFolder() == SceneIdentity::FolderHEHZ) {
         sVars->aniFrames.Load("HEHZ/Snowflakes.bin", SCOPE_STAGE);
         sVars->holiday = true;
     }
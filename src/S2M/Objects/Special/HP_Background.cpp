@@ -71,15 +71,31 @@ void HP_Background::Draw()
     drawPos.x = TO_FIXED(this->drawPos.x + screenInfo[sceneInfo->currentScreenID].center.x);
     drawPos.y = TO_FIXED(this->drawPos.y + screenInfo[sceneInfo->currentScreenID].center.y);
 
-    int32 start = 0;
-    int32 end   = 12;
-    if (this->rotation) {
-        start = 1;
-        end   = 11;
+    if (!this->BuildCanvas()) {
+        int32 start = 0;
+        int32 end   = 12;
+        if (this->rotation) {
+            start = 1;
+            end   = 11;
+        }
+
+        for (int32 f = start; f < end; ++f) {
+            this->animator.frameID = f;
+            this->animator.DrawSprite(&drawPos, true);
+        }
+        return;
     }
 
-    for (int32 f = start; f < end; ++f) {
-        this->animator.frameID = f;
+    // frames 1-10 are always drawn, so they come from the canvas. 0 & 11 get drawn around it as usual when there's no rotation
+    if (!this->rotation) {
+        this->animator.frameID = 0;
+        this->animator.DrawSprite(&drawPos, true);
+    }
+
+    this->DrawCanvas(FROM_FIXED(drawPos.x), FROM_FIXED(drawPos.y));
+
+    if (!this->rotation) {
+        this->animator.frameID = 11;
         this->animator.DrawSprite(&drawPos, true);
     }
 }
@@ -100,6 +116,128 @@ void HP_Background::StageLoad()
     for (auto zone : GameObject::GetEntities<HP_Background>(FOR_ALL_ENTITIES)) zone->Destroy();
     // ... and ensure we have a bg entity in the correct reserved slot
     GameObject::Reset(SLOT_HP_BG, sVars->classID, nullptr);
+
+    HP_Background::ReleaseCanvas();
+}
+
+bool32 HP_Background::BuildCanvas()
+{
+    SpriteFrame *frames = this->animator.frames;
+    if (!frames || this->animator.frameCount < 12) {
+        HP_Background::ReleaseCanvas();
+        return false;
+    }
+
+    // palettes & scrolling are applied when the canvas is blitted, so it only depends on the frames & the sheet pixels they point to
+    CanvasSource sources[HP_BG_CANVAS_FRAMES];
+    for (int32 f = 0; f < HP_BG_CANVAS_FRAMES; ++f) {
+        SpriteFrame *frame             = &frames[f + 1];
+        HP_Halfpipe::GFXSurface *sheet = (HP_Halfpipe::GFXSurface *)Mod::Engine::GetSpriteSurface(frame->sheetID);
+
+        sources[f].pixels = sheet ? sheet->pixels : nullptr;
+        sources[f].sprX   = frame->sprX;
+        sources[f].sprY   = frame->sprY;
+        sources[f].width  = frame->width;
+        sources[f].height = frame->height;
+        sources[f].pivotX = frame->pivotX;
+        sources[f].pivotY = frame->pivotY;
+    }
+
+    if (sVars->canvasChecked && !memcmp(sources, sVars->canvasSources, sizeof(sources)))
+        return sVars->canvasReady;
+
+    memcpy(sVars->canvasSources, sources, sizeof(sources));
+    sVars->canvasChecked = true;
+    sVars->canvasReady   = false;
+
+    int32 left   = 0x7FFF;
+    int32 top    = 0x7FFF;
+    int32 right  = -0x7FFF;
+    int32 bottom = -0x7FFF;
+    for (int32 f = 0; f < HP_BG_CANVAS_FRAMES; ++f) {
+        if (!sources[f].pixels)
+            return false;
+
+        left   = MIN(left, sources[f].pivotX);
+        top    = MIN(top, sources[f].pivotY);
+        right  = MAX(right, sources[f].pivotX + sources[f].width);
+        bottom = MAX(bottom, sources[f].pivotY + sources[f].height);
+    }
+
+    if (right - left > HP_BG_CANVAS_WIDTH || bottom - top > HP_BG_CANVAS_HEIGHT)
+        return false;
+
+    free(sVars->canvas);
+    sVars->canvasWidth  = right - left;
+    sVars->canvasHeight = bottom - top;
+    sVars->canvas       = (uint8 *)calloc(sVars->canvasWidth * sVars->canvasHeight, sizeof(uint8));
+    if (!sVars->canvas)
+        return false;
+
+    // composite the frames in draw order, later frames overwrite earlier ones wherever they aren't transparent
+    for (int32 f = 0; f < HP_BG_CANVAS_FRAMES; ++f) {
+        CanvasSource *source           = &sources[f];
+        HP_Halfpipe::GFXSurface *sheet = (HP_Halfpipe::GFXSurface *)Mod::Engine::GetSpriteSurface(frames[f + 1].sheetID);
+
+        uint8 *canvasLine = &sVars->canvas[(source->pivotY - top) * sVars->canvasWidth + (source->pivotX - left)];
+        for (int32 y = 0; y < source->height; ++y) {
+            uint8 *sheetLine = &source->pixels[((source->sprY + y) << sheet->lineSize) + source->sprX];
+            for (int32 x = 0; x < source->width; ++x) {
+                if (sheetLine[x])
+                    canvasLine[x] = sheetLine[x];
+            }
+            canvasLine += sVars->canvasWidth;
+        }
+    }
+
+    sVars->canvasLeft  = left;
+    sVars->canvasTop   = top;
+    sVars->canvasReady = true;
+    return true;
+}
+
+void HP_Background::DrawCanvas(int32 x, int32 y)
+{
+    ScreenInfo *currentScreen = &screenInfo[sceneInfo->currentScreenID];
+
+    int32 left   = x + sVars->canvasLeft;
+    int32 top    = y + sVars->canvasTop;
+    int32 startX = MAX(left, currentScreen->clipBound_X1);
+    int32 startY = MAX(top, currentScreen->clipBound_Y1);
+    int32 endX   = MIN(left + sVars->canvasWidth, currentScreen->clipBound_X2);
+    int32 endY   = MIN(top + sVars->canvasHeight, currentScreen->clipBound_Y2);
+    if (startX >= endX || startY >= endY)
+        return;
+
+    uint8 *gfxLineBuffer = Mod::Engine::GetActivePaletteBuffer();
+    uint16 *frameBuffer  = &currentScreen->frameBuffer[startY * currentScreen->pitch + startX];
+    uint8 *canvasLine    = &sVars->canvas[(startY - top) * sVars->canvasWidth + (startX - left)];
+
+    int32 count = endX - startX;
+    for (int32 s = startY; s < endY; ++s) {
+        uint16 *palettePtr = Mod::Engine::GetPaletteBank(gfxLineBuffer[s]);
+
+        for (int32 p = 0; p < count; ++p) {
+            uint8 index = canvasLine[p];
+            if (index)
+                frameBuffer[p] = palettePtr[index];
+        }
+
+        canvasLine += sVars->canvasWidth;
+        frameBuffer += currentScreen->pitch;
+    }
+}
+
+// Zone calls this on every stage load, so the canvas only exists while the special stage is drawing it
+void HP_Background::ReleaseCanvas()
+{
+    if (!sVars)
+        return;
+
+    free(sVars->canvas);
+    sVars->canvas        = nullptr;
+    sVars->canvasChecked = false;
+    sVars->canvasReady   = false;
 }
 
 #if RETRO_INCLUDE_EDITOR
@@ -4,6 +4,11 @@
 namespace GameLogic
 {
 
+// largest canvas BuildCanvas will allocate, anything bigger falls back to drawing the frames
+#define HP_BG_CANVAS_WIDTH  (1024)
+#define HP_BG_CANVAS_HEIGHT (768)
+#define HP_BG_CANVAS_FRAMES (10) // frames 1-10
+
 struct HP_Background : RSDK::GameObject::Entity {
 
     // ==============================
@@ -14,12 +19,31 @@ struct HP_Background : RSDK::GameObject::Entity {
     // STRUCTS
     // ==============================
 
+    // everything the canvas was composited from, if any of it changes the canvas is rebuilt
+    struct CanvasSource {
+        uint8 *pixels;
+        int32 sprX;
+        int32 sprY;
+        int32 width;
+        int32 height;
+        int32 pivotX;
+        int32 pivotY;
+    };
+
     // ==============================
     // STATIC VARS
     // ==============================
 
     struct Static : RSDK::GameObject::Static {
         RSDK::SpriteAnimation aniFrames;
+        uint8 *canvas; // only allocated while the background is being drawn, see BuildCanvas & ReleaseCanvas
+        CanvasSource canvasSources[HP_BG_CANVAS_FRAMES];
+        int32 canvasLeft;
+        int32 canvasTop;
+        int32 canvasWidth;
+        int32 canvasHeight;
+        bool32 canvasChecked;
+        bool32 canvasReady;
     };
 
     // ==============================
@@ -54,6 +78,10 @@ struct HP_Background : RSDK::GameObject::Entity {
     // FUNCTIONS
     // ==============================
 
+    bool32 BuildCanvas();
+    void DrawCanvas(int32 x, int32 y);
+    static void ReleaseCanvas();
+
     // ==============================
     // DECLARATION
     // ==============================
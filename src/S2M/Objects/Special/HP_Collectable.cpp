@@ -21,7 +21,12 @@ RSDK_REGISTER_OBJECT(HP_Collectable);
 
 void HP_Collectable::Update() { this->state.Run(this); }
 void HP_Collectable::LateUpdate() {}
-void HP_Collectable::StaticUpdate() {}
+void HP_Collectable::StaticUpdate()
+{
+    // players update before any collectable does, and each one widens this as it goes
+    sVars->pickupWindowStart = 0x7FFFFFFF;
+    sVars->pickupWindowEnd   = -0x7FFFFFFF;
+}
 void HP_Collectable::Draw() { this->stateDraw.Run(this); }
 
 void HP_Collectable::Create(void *data)
@@ -115,7 +120,7 @@ void HP_Collectable::State_Ring()
     if (this->localPos.z < halfpipe->playerZPos) {
         this->Destroy();
     }
-    else {
+    else if (this->localPos.z > sVars->pickupWindowStart && this->localPos.z < sVars->pickupWindowEnd) {
         for (auto player : GameObject::GetEntities<HP_Player>(FOR_ACTIVE_ENTITIES)) {
             if (player->localPos.z > this->localPos.z - 0x20000 && player->localPos.z < this->localPos.z + 0x20000) {
                 int32 rx = player->localPos.x - this->localPos.x;
@@ -143,7 +148,7 @@ void HP_Collectable::State_Bomb()
     if (this->localPos.z < halfpipe->playerZPos) {
         this->Destroy();
     }
-    else {
+    else if (this->localPos.z > sVars->pickupWindowStart && this->localPos.z < sVars->pickupWindowEnd) {
         for (auto player : GameObject::GetEntities<HP_Player>(FOR_ACTIVE_ENTITIES)) {
             if (player->localPos.z > this->localPos.z - 0x20000 && player->localPos.z < this->localPos.z + 0x20000) {
                 int32 rx = player->localPos.x - this->localPos.x;
@@ -408,6 +413,12 @@ void HP_Collectable::Draw_LostRing()
     this->animator.DrawSprite(&drawPos, true);
 }
 
+void HP_Collectable::ExtendPickupWindow(int32 z)
+{
+    sVars->pickupWindowStart = MIN(sVars->pickupWindowStart, z - 0x20000);
+    sVars->pickupWindowEnd   = MAX(sVars->pickupWindowEnd, z + 0x20000);
+}
+
 void HP_Collectable::LoseRings(RSDK::Vector2 *position, int32 lossAngle, int32 rings, uint8 drawGroup)
 {
     HP_Player *player1 = GameObject::Get<HP_Player>(SLOT_HP_PLAYER1);
@@ -32,6 +32,8 @@ struct HP_Collectable : RSDK::GameObject::Entity {
         RSDK::SoundFX sfxBomb;
         RSDK::SoundFX sfxEmerald;
         int32 pan;
+        int32 pickupWindowStart; // z range around every player that updated this frame
+        int32 pickupWindowEnd;
     };
 
     // ==============================
@@ -94,6 +96,7 @@ struct HP_Collectable : RSDK::GameObject::Entity {
     void Draw_LostRing();
 
     // Misc
+    static void ExtendPickupWindow(int32 z);
     static void LoseRings(RSDK::Vector2 *position, int32 lossAngle, int32 rings, uint8 drawGroup);
 
     // ==============================
@@ -13,6 +13,7 @@
 #include "Global/Zone.hpp"
 
 #include "Helpers/LogHelpers.hpp"
+#include "Helpers/StateProfiler.hpp"
 
 using namespace RSDK;
 
@@ -67,6 +68,8 @@ RSDK_REGISTER_OBJECT(HP_Halfpipe);
 
 void HP_Halfpipe::Update()
 {
+    S2M_PROFILE_EVENT();
+
     sVars->scene3D.vertexCount = sVars->prevVertexCount;
     sVars->scene3D.faceCount   = sVars->faceCount;
 
@@ -189,6 +192,8 @@ void HP_Halfpipe::Update()
 void HP_Halfpipe::LateUpdate() {}
 void HP_Halfpipe::StaticUpdate()
 {
+    S2M_PROFILE_STATIC_EVENT();
+
     // gotta be done here to prevent double Create() calls that come if you spawn an entity in StageLoad()
     if (!sVars->initialized) {
         // ... and ensure we have a halfpipe entity in the correct reserved slot
@@ -220,6 +225,8 @@ void HP_Halfpipe::StaticUpdate()
 }
 void HP_Halfpipe::Draw()
 {
+    S2M_PROFILE_EVENT();
+
     MatrixTranslateXYZ(&sVars->scene3D.matWorld, this->halfpipeTranslation.x, this->halfpipeTranslation.y, this->halfpipeTranslation.z);
     MatrixRotateXYZ(&sVars->scene3D.matView, this->halfpipeRotation.x, this->halfpipeRotation.y, this->halfpipeRotation.z);
     sVars->scene3D.matView.Inverse();
@@ -1736,6 +1743,8 @@ void HP_Halfpipe::SortDrawList(int32 first, int32 last)
 }
 void HP_Halfpipe::Draw3DScene()
 {
+    S2M_PROFILE_FUNCTION();
+
     ScreenInfo *screen = &screenInfo[sceneInfo->currentScreenID];
 
     TransformVertexBuffer();
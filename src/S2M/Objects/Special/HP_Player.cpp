@@ -34,6 +34,9 @@ void HP_Player::Update()
     this->localPos.y      = FROM_FIXED(this->position.y) >> 1;
     this->localPos.z      = (this->zpos << 8) + halfpipe->playerZPos + 0xC0000;
 
+    if (HP_Collectable::sVars)
+        HP_Collectable::ExtendPickupWindow(this->localPos.z);
+
     this->animator.Process();
 
     this->Draw_Normal();
@@ -5,6 +5,7 @@
 // ---------------------------------------------------------------------
 
 #include "Twinkle.hpp"
+#include "Global/Zone.hpp"
 #include "Sega.hpp"
 
 using namespace RSDK;
@@ -48,7 +49,7 @@ void Twinkle::Create(void *data)
         else { // normal twinkling star
             this->drawGroup = 4;
             sVars->sfxTwinkle.Play(false, 255); // making this a part of the twinkle object itself is just more convenient lol
-            if (Stage::CheckSceneFolder("Logos")) { // different bins are used for whether its title or logos, so if check here to change the animation used
+            if (Zone::SceneFolder() == SceneIdentity::FolderLogos) { // different bins are used for whether its title or logos, so if check here to change the animation used
                 this->animator.SetAnimation(sVars->aniFrames, 4, false, 0);
             }
             else {
@@ -60,7 +61,7 @@ void Twinkle::Create(void *data)
 
 void Twinkle::StageLoad() 
 {
-    if (Stage::CheckSceneFolder("Logos")) {
+    if (Zone::SceneFolder() == SceneIdentity::FolderLogos) {
         sVars->aniFrames.Load("Logos/Logos.bin", SCOPE_STAGE);
     }
     else {
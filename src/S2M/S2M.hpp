@@ -203,13 +203,16 @@ struct GlobalVariables {
     int32 taTableLoaded;
     int32 replayTableID;
     int32 replayTableLoaded;
-    int32 replayWriteBuffer[0x40000];
-    int32 replayReadBuffer[0x40000];
-    int32 replayTempWBuffer[0x40000];
-    int32 replayTempRBuffer[0x40000];
+    // only allocated while time attack needs them, see ReplayRecorder::AcquireBuffers
+    int32 *replayWriteBuffer;
+    int32 *replayReadBuffer;
+    int32 *replayTempWBuffer;
+    int32 *replayTempRBuffer;
     int32 medallionDebug;
     int32 notifiedAutosave;
     int32 recallEntities;
+    int32 recallSlotCount; // scene slots with something other than RecallNormal stored for them in atlEntityData
+    uint16 recallSlots[SCENEENTITY_COUNT];
     int32 restartRings;
     int32 restart1UP;
     int32 restartPowerups;